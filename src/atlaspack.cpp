@@ -0,0 +1,186 @@
+#include <SDL3/SDL.h>
+#include <SDL3_image/SDL_image.h>
+#include "atlas_packer.h"
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Pack images into as few atlas pages as possible at build time, so a program
+// decodes and uploads one texture instead of one per image. Writes
+// OUTPUT_DIR/atlas0.bmp, atlas1.bmp, ... and the manifest OUTPUT_DIR/atlas.txt
+// that AtlasCache reads.
+//
+//   atlaspack [--size N] OUTPUT_DIR IMAGE...
+//
+// Every image gets a one pixel border copied from its edge pixels so scaled,
+// filtered sprites never sample their neighbours.
+
+static constexpr int padding = 1;
+
+struct Image
+{
+    std::string name;
+    SDL_Surface* surface = nullptr; // ARGB8888
+    int page = -1;
+    SDL_Rect rect{}; // including padding
+};
+
+// File name without directory and extension
+static std::string
+ImageName(const std::string& path)
+{
+    size_t slash = path.find_last_of("/\\");
+    std::string name =
+      slash == std::string::npos ? path : path.substr(slash + 1);
+    size_t dot = name.rfind('.');
+    return dot == std::string::npos ? name : name.substr(0, dot);
+}
+
+// Copy `image` into `page` at its rect, extruding the edge pixels into the
+// padding around it
+static void
+Blit(const Image& image, SDL_Surface* page)
+{
+    const SDL_Surface* src = image.surface;
+    for (int y = 0; y < image.rect.h; y++) {
+        int sy = SDL_clamp(y - padding, 0, src->h - 1);
+        const Uint32* in =
+          (const Uint32*)((const Uint8*)src->pixels + sy * src->pitch);
+        Uint32* out = (Uint32*)((Uint8*)page->pixels +
+                                (image.rect.y + y) * page->pitch) +
+                      image.rect.x;
+        for (int x = 0; x < image.rect.w; x++)
+            out[x] = in[SDL_clamp(x - padding, 0, src->w - 1)];
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    int pageSize = 2048;
+    int arg = 1;
+    if (arg + 1 < argc && SDL_strcmp(argv[arg], "--size") == 0) {
+        pageSize = SDL_atoi(argv[arg + 1]);
+        arg += 2;
+    }
+    if (argc - arg < 2 || pageSize <= 0) {
+        std::cerr << "usage: atlaspack [--size N] OUTPUT_DIR IMAGE...\n";
+        return 1;
+    }
+
+    std::string outputDir = argv[arg++];
+    if (outputDir.back() != '/' && outputDir.back() != '\\')
+        outputDir += '/';
+
+    std::vector<Image> images;
+    bool ok = true;
+    for (; arg < argc; arg++) {
+        Image image;
+        image.name = ImageName(argv[arg]);
+        for (const Image& other : images)
+            if (other.name == image.name) {
+                std::cerr << "duplicate image name " << image.name << "\n";
+                ok = false;
+            }
+
+        SDL_Surface* loaded = IMG_Load(argv[arg]);
+        if (!loaded) {
+            std::cerr << argv[arg] << ": " << SDL_GetError() << "\n";
+            ok = false;
+            continue;
+        }
+        image.surface = SDL_ConvertSurface(loaded, SDL_PIXELFORMAT_ARGB8888);
+        SDL_DestroySurface(loaded);
+        if (!image.surface) {
+            std::cerr << argv[arg] << ": " << SDL_GetError() << "\n";
+            ok = false;
+            continue;
+        }
+        images.push_back(image);
+    }
+
+    // Ảnh cao trước cho skyline ít lỗ hổng
+    std::vector<Image*> order;
+    for (Image& image : images)
+        order.push_back(&image);
+    std::stable_sort(order.begin(), order.end(), [](Image* a, Image* b) {
+        if (a->surface->h != b->surface->h)
+            return a->surface->h > b->surface->h;
+        return a->surface->w > b->surface->w;
+    });
+
+    std::vector<SkylinePacker> packers;
+    for (Image* image : order) {
+        int w = image->surface->w + 2 * padding;
+        int h = image->surface->h + 2 * padding;
+        for (size_t p = 0; p < packers.size() && image->page < 0; p++)
+            if (packers[p].insert(w, h, image->rect))
+                image->page = (int)p;
+        if (image->page < 0) {
+            packers.emplace_back(pageSize, pageSize);
+            if (!packers.back().insert(w, h, image->rect)) {
+                std::cerr << image->name << " (" << w << "x" << h
+                          << ") does not fit a " << pageSize << " page\n";
+                ok = false;
+                packers.pop_back();
+                continue;
+            }
+            image->page = (int)packers.size() - 1;
+        }
+    }
+
+    std::string manifest;
+    for (size_t p = 0; ok && p < packers.size(); p++) {
+        // Trang chỉ lớn bằng phần đã dùng
+        SDL_Surface* page = SDL_CreateSurface(packers[p].getUsedWidth(),
+                                              packers[p].getUsedHeight(),
+                                              SDL_PIXELFORMAT_ARGB8888);
+        if (!page) {
+            std::cerr << SDL_GetError() << "\n";
+            ok = false;
+            break;
+        }
+        SDL_memset(page->pixels, 0, (size_t)page->pitch * page->h);
+        for (const Image& image : images)
+            if (image.page == (int)p)
+                Blit(image, page);
+
+        std::string file = "atlas" + std::to_string(p) + ".bmp";
+        if (!SDL_SaveBMP(page, (outputDir + file).c_str())) {
+            std::cerr << outputDir << file << ": " << SDL_GetError() << "\n";
+            ok = false;
+        }
+        std::cout << file << ": " << page->w << "x" << page->h << "\n";
+        SDL_DestroySurface(page);
+        manifest += "page " + std::to_string(p) + " " + file + "\n";
+    }
+
+    for (const Image& image : images) {
+        if (!ok)
+            break;
+        manifest += "sprite " + image.name + " " + std::to_string(image.page);
+        for (int v : { image.rect.x + padding,
+                       image.rect.y + padding,
+                       image.surface->w,
+                       image.surface->h })
+            manifest += " " + std::to_string(v);
+        manifest += "\n";
+    }
+    for (Image& image : images)
+        SDL_DestroySurface(image.surface);
+
+    // Manifest ghi sau cùng: nó là output mà CMake theo dõi
+    if (ok && !SDL_SaveFile((outputDir + "atlas.txt").c_str(),
+                            manifest.data(),
+                            manifest.size())) {
+        std::cerr << outputDir << "atlas.txt: " << SDL_GetError() << "\n";
+        ok = false;
+    }
+    if (!ok)
+        return 1;
+
+    std::cout << images.size() << " images in " << packers.size()
+              << " page(s)\n";
+    return 0;
+}
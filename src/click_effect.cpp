@@ -1,6 +1,12 @@
 #include <SDL3/SDL.h>
+#include "circle_atlas.h"
+#include "frame_scheduler.h"
+#include "input_pump.h"
+#include "ripple_kernel.h"
+#include "ripple_pool.h"
 #include <vector>
 #include <cmath>
+#include <algorithm>
 #include <iostream>
 
 class Effect
@@ -33,7 +39,14 @@ class Effect
         return true;
     }
 
-    void render(SDL_Renderer* r)
+    void render(SDL_Renderer* r) { renderPixels(r, x, y, radius, alpha); }
+
+    // Per-pixel reference path, kept for frame-time comparison
+    static void renderPixels(SDL_Renderer* r,
+                             float x,
+                             float y,
+                             float radius,
+                             float alpha)
     {
         SDL_SetRenderDrawColor(r, 255, 255, 255, (Uint8)alpha);
         int rad = (int)radius;
@@ -43,47 +56,366 @@ class Effect
                 SDL_RenderPoint(r, (int)x + i, (int)y + dy);
         }
     }
+
+    // Append the disc as a triangle fan so every live effect can go out in a
+    // single SDL_RenderGeometry call
+    static void appendGeometry(std::vector<SDL_Vertex>& vertices,
+                               std::vector<int>& indices,
+                               float x,
+                               float y,
+                               float radius,
+                               float alpha)
+    {
+        if (radius < 0.5f)
+            return;
+
+        // Roughly one rim vertex per 4px of circumference, clamped so small
+        // ripples stay round and big ones don't waste vertices
+        int segments = std::clamp((int)(radius * 1.5f), 12, 96);
+        SDL_FColor color = { 1.0f, 1.0f, 1.0f, alpha / 255.0f };
+
+        int center = (int)vertices.size();
+        vertices.push_back({ { x, y }, color, { 0.0f, 0.0f } });
+        for (int i = 0; i < segments; i++) {
+            float angle = i * 2.0f * SDL_PI_F / segments;
+            vertices.push_back({ { x + radius * SDL_cosf(angle),
+                                   y + radius * SDL_sinf(angle) },
+                                 color,
+                                 { 0.0f, 0.0f } });
+        }
+        for (int i = 0; i < segments; i++) {
+            indices.push_back(center);
+            indices.push_back(center + 1 + i);
+            indices.push_back(center + 1 + (i + 1) % segments);
+        }
+    }
 };
 
+// Gom tất cả effect vào một lần SDL_RenderGeometry mỗi frame
+class EffectBatch
+{
+  private:
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+
+  public:
+    void render(SDL_Renderer* r, const RipplePool& pool)
+    {
+        vertices.clear();
+        indices.clear();
+        for (size_t i = 0; i < pool.size(); i++)
+            Effect::appendGeometry(vertices,
+                                   indices,
+                                   pool.x[i],
+                                   pool.y[i],
+                                   pool.radius[i],
+                                   pool.alpha[i]);
+
+        if (indices.empty())
+            return;
+        SDL_RenderGeometry(r,
+                           nullptr,
+                           vertices.data(),
+                           (int)vertices.size(),
+                           indices.data(),
+                           (int)indices.size());
+    }
+};
+
+// Mỗi effect là một quad lấy từ atlas; bán kính chỉ có khoảng 50 giá trị
+// nguyên nên mỗi đĩa chỉ rasterize một lần, và tất cả quad đi chung một lần
+// SDL_RenderGeometry
+class EffectAtlas
+{
+  private:
+    CircleAtlas atlas;
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+
+  public:
+    EffectAtlas(SDL_Renderer* r)
+      : atlas(r, (int)RipplePool::maxRadius + 1)
+    {
+    }
+
+    void render(SDL_Renderer* r, const RipplePool& pool)
+    {
+        SDL_Texture* texture = atlas.getTexture();
+        if (!texture)
+            return;
+
+        vertices.clear();
+        indices.clear();
+        float inv = 1.0f / atlas.getSize();
+        for (size_t i = 0; i < pool.size(); i++) {
+            const SDL_FRect* src = atlas.discRect((int)(pool.radius[i] + 0.5f));
+            if (!src)
+                continue;
+
+            float half = src->w / 2.0f;
+            float x0 = pool.x[i] - half, y0 = pool.y[i] - half;
+            float x1 = pool.x[i] + half, y1 = pool.y[i] + half;
+            float u0 = src->x * inv, v0 = src->y * inv;
+            float u1 = (src->x + src->w) * inv, v1 = (src->y + src->h) * inv;
+            SDL_FColor color = { 1.0f, 1.0f, 1.0f, pool.alpha[i] / 255.0f };
+
+            int base = (int)vertices.size();
+            vertices.push_back({ { x0, y0 }, color, { u0, v0 } });
+            vertices.push_back({ { x1, y0 }, color, { u1, v0 } });
+            vertices.push_back({ { x1, y1 }, color, { u1, v1 } });
+            vertices.push_back({ { x0, y1 }, color, { u0, v1 } });
+            for (int k : { 0, 1, 2, 2, 3, 0 })
+                indices.push_back(base + k);
+        }
+
+        if (indices.empty())
+            return;
+        // drawDisc có thể đã đổi mod của texture
+        SDL_SetTextureColorMod(texture, 255, 255, 255);
+        SDL_SetTextureAlphaMod(texture, 255);
+        SDL_RenderGeometry(r,
+                           texture,
+                           vertices.data(),
+                           (int)vertices.size(),
+                           indices.data(),
+                           (int)indices.size());
+    }
+};
+
+// Average update/render cost per mode, logged once a second so the paths can
+// be compared under the same click load (cycle with B). Cost is also
+// normalized per 1k live particles for the stress mode.
+struct FrameTimer
+{
+    Uint64 updateTotal = 0;
+    Uint64 renderTotal = 0;
+    Uint64 lastReport = SDL_GetTicks();
+    int frames = 0;
+    size_t effects = 0;
+
+    void add(Uint64 updateElapsed, Uint64 renderElapsed, size_t liveEffects)
+    {
+        updateTotal += updateElapsed;
+        renderTotal += renderElapsed;
+        effects += liveEffects;
+        frames++;
+    }
+
+    void report(const char* mode)
+    {
+        Uint64 now = SDL_GetTicks();
+        if (now - lastReport < 1000 || frames == 0)
+            return;
+
+        double toMs = 1000.0 / SDL_GetPerformanceFrequency() / frames;
+        double updateMs = updateTotal * toMs;
+        double renderMs = renderTotal * toMs;
+        double live = (double)effects / frames;
+        SDL_Log("%s: update %.3f ms, render %.3f ms, %.1f effects avg, %d "
+                "frames",
+                mode,
+                updateMs,
+                renderMs,
+                live,
+                frames);
+        if (live >= 1000.0)
+            SDL_Log("  per 1k particles: update %.1f us, render %.1f us",
+                    updateMs * 1000.0 / (live / 1000.0),
+                    renderMs * 1000.0 / (live / 1000.0));
+        updateTotal = 0;
+        renderTotal = 0;
+        effects = 0;
+        frames = 0;
+        lastReport = now;
+    }
+};
+
+// --bench-kernel [N]: particles/second của Effect::update (per-object, một
+// lần SDL_GetTicks mỗi object) so với từng batch kernel trên N particles
+static void
+benchKernels(size_t count)
+{
+    const int iterations = 50;
+    const double freq = (double)SDL_GetPerformanceFrequency();
+    Uint32 now = (Uint32)SDL_GetTicks();
+
+    // Tuổi rải đều trong [0, 600) ms nên khoảng 1/6 số particle đã chết
+    std::vector<Uint32> start(count);
+    for (auto& s : start)
+        s = now - (Uint32)SDL_rand(600);
+
+    auto report = [&](const char* name, Uint64 ticks) {
+        double seconds = ticks / freq;
+        SDL_Log("%-10s %8.1f M particles/s",
+                name,
+                count * (double)iterations / seconds / 1e6);
+    };
+
+    size_t sink = 0;
+    std::vector<Effect> objects(count, Effect(0, 0));
+    for (size_t i = 0; i < count; i++)
+        objects[i].start = start[i];
+    Uint64 t0 = SDL_GetPerformanceCounter();
+    for (int it = 0; it < iterations; it++)
+        for (auto& effect : objects)
+            sink += effect.update();
+    report("per-object", SDL_GetPerformanceCounter() - t0);
+
+    struct
+    {
+        const char* name;
+        RippleKernelFn fn;
+        bool supported;
+    } kernels[] = {
+        { "scalar", rippleKernelScalar, true },
+#ifdef RIPPLE_KERNEL_X86
+        { "sse2", rippleKernelSSE2, SDL_HasSSE2() },
+        { "avx2", rippleKernelAVX2, SDL_HasAVX2() },
+#endif
+    };
+
+    std::vector<float> radius(count), alpha(count);
+    std::vector<Uint8> alive(count);
+    std::vector<float> refRadius(count), refAlpha(count);
+    std::vector<Uint8> refAlive(count);
+    rippleKernelScalar(start.data(),
+                       refRadius.data(),
+                       refAlpha.data(),
+                       refAlive.data(),
+                       count,
+                       now,
+                       RipplePool::lifetime,
+                       RipplePool::maxRadius);
+
+    for (const auto& kernel : kernels) {
+        if (!kernel.supported)
+            continue;
+
+        t0 = SDL_GetPerformanceCounter();
+        for (int it = 0; it < iterations; it++) {
+            kernel.fn(start.data(),
+                      radius.data(),
+                      alpha.data(),
+                      alive.data(),
+                      count,
+                      now,
+                      RipplePool::lifetime,
+                      RipplePool::maxRadius);
+            sink += alive[it % count];
+        }
+        report(kernel.name, SDL_GetPerformanceCounter() - t0);
+
+        if (radius != refRadius || alpha != refAlpha || alive != refAlive)
+            SDL_Log("  %s: results differ from scalar kernel", kernel.name);
+    }
+    SDL_Log("(%zu live checks)", sink);
+}
+
 int
-main()
+main(int argc, char* argv[])
 {
+    // --stress N: bắn N click giả lập mỗi bước update (100 Hz) khi bật
+    // stress mode (phím S), nên tải không phụ thuộc frame rate
+    int stressRate = 200;
+    bool stress = false;
+    for (int i = 1; i < argc; i++) {
+        if (SDL_strcmp(argv[i], "--stress") == 0) {
+            stress = true;
+            if (i + 1 < argc)
+                stressRate = std::max(1, SDL_atoi(argv[++i]));
+        } else if (SDL_strcmp(argv[i], "--bench-kernel") == 0) {
+            int count = i + 1 < argc ? SDL_atoi(argv[i + 1]) : 0;
+            benchKernels(count > 0 ? count : 1 << 20);
+            return 0;
+        }
+    }
+
     SDL_Init(SDL_INIT_VIDEO);
     auto window = SDL_CreateWindow("Blue Archive Click", 800, 600, 0);
     auto renderer = SDL_CreateRenderer(window, nullptr);
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
 
-    std::vector<Effect> effects;
-    SDL_Event e;
-    bool running = true;
-
-    while (running) {
-        while (SDL_PollEvent(&e)) {
-            if (e.type == SDL_EVENT_QUIT ||
-                (e.type == SDL_EVENT_KEY_DOWN && e.key.key == SDLK_ESCAPE))
-                running = false;
-            if (e.type == SDL_EVENT_MOUSE_BUTTON_DOWN &&
-                e.button.button == SDL_BUTTON_LEFT)
-                effects.emplace_back(e.button.x, e.button.y);
-        }
+    {
+        // Atlas texture phải được hủy trước renderer
+        RipplePool effects;
+        EffectBatch batch;
+        EffectAtlas atlas(renderer);
+        FrameTimer timer;
+        const char* pathNames[] = { "per-pixel", "batched", "atlas" };
+        int path = 2;
+        FrameScheduler scheduler("click", 60.0, 100.0);
+        scheduler.setVSync(renderer);
+        InputPump input("click");
+        SDL_Log("ripple kernel: %s", effects.getKernelName());
+        bool running = true;
 
-        // Update và cleanup
-        for (auto it = effects.begin(); it != effects.end();) {
-            it = it->update() ? ++it : effects.erase(it);
-        }
+        while (running) {
+            int steps = scheduler.beginFrame();
+
+            // Một timestamp cho cả frame
+            Uint32 now = (Uint32)SDL_GetTicks();
 
-        // Render
-        SDL_SetRenderDrawColor(renderer, 25, 35, 55, 255);
-        SDL_RenderClear(renderer);
-        for (auto& effect : effects)
-            effect.render(renderer);
-        SDL_RenderPresent(renderer);
+            input.poll();
+            for (const SDL_Event& e : input.drain()) {
+                if (e.type == SDL_EVENT_QUIT ||
+                    (e.type == SDL_EVENT_KEY_DOWN && e.key.key == SDLK_ESCAPE))
+                    running = false;
+                if (e.type == SDL_EVENT_MOUSE_BUTTON_DOWN &&
+                    e.button.button == SDL_BUTTON_LEFT)
+                    effects.spawn(e.button.x, e.button.y, now);
+                if (e.type == SDL_EVENT_KEY_DOWN && e.key.key == SDLK_B) {
+                    path = (path + 1) % 3;
+                    timer = FrameTimer();
+                    SDL_Log("render path: %s", pathNames[path]);
+                }
+                if (e.type == SDL_EVENT_KEY_DOWN && e.key.key == SDLK_S) {
+                    stress = !stress;
+                    timer = FrameTimer();
+                    SDL_Log("stress mode: %s (%d clicks/step)",
+                            stress ? "on" : "off",
+                            stressRate);
+                }
+            }
 
-        SDL_Delay(10);
+            if (stress) {
+                for (int i = 0; i < steps * stressRate; i++)
+                    effects.spawn(SDL_randf() * 800, SDL_randf() * 600, now);
+            }
+
+            // Update và cleanup
+            Uint64 updateStart = SDL_GetPerformanceCounter();
+            effects.update(now);
+            Uint64 updateEnd = SDL_GetPerformanceCounter();
+
+            // Render
+            SDL_SetRenderDrawColor(renderer, 25, 35, 55, 255);
+            SDL_RenderClear(renderer);
+            Uint64 renderStart = SDL_GetPerformanceCounter();
+            if (path == 0) {
+                for (size_t i = 0; i < effects.size(); i++)
+                    Effect::renderPixels(renderer,
+                                         effects.x[i],
+                                         effects.y[i],
+                                         effects.radius[i],
+                                         effects.alpha[i]);
+            } else if (path == 1) {
+                batch.render(renderer, effects);
+            } else {
+                atlas.render(renderer, effects);
+            }
+            SDL_RenderPresent(renderer);
+            input.presented();
+            timer.add(updateEnd - updateStart,
+                      SDL_GetPerformanceCounter() - renderStart,
+                      effects.size());
+            timer.report(pathNames[path]);
+
+            scheduler.endFrame();
+        }
     }
 
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     SDL_Quit();
     return 0;
-}
\ No newline at end of file
+}
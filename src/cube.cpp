@@ -1,21 +1,20 @@
 #include <SDL3/SDL.h>
+#include "frame_scheduler.h"
+#include "input_pump.h"
+#include "clip_stage.h"
+#include "depth_sort.h"
+#include "mesh.h"
+#include "scene_graph.h"
+#include "soft_raster.h"
+#include "thread_pool.h"
+#include "tile_raster.h"
+#include "transform_kernel.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <iostream>
 #include <vector>
 #include <algorithm>
-
-struct Vertex
-{
-    glm::vec3 position;
-    glm::vec3 color;
-};
-
-struct Triangle
-{
-    Vertex v1, v2, v3;
-    float depth; // Để depth sorting
-};
+#include <cmath>
 
 class SimpleCube
 {
@@ -25,13 +24,100 @@ class SimpleCube
     SDL_Texture* frameBuffer;
     int screenWidth, screenHeight;
 
-    std::vector<Vertex> cubeVertices;
-    std::vector<Triangle> triangles;
+    // Framebuffer CPU, mỗi frame upload một lần vào frameBuffer. Tam giác
+    // được chia theo tile và rasterize song song trên thread pool
+    SoftRasterizer rasterizer;
+    ThreadPool pool;
+    TiledRasterizer tiled;
+    int threadCount;
+
+    // Indexed mesh: mỗi đỉnh chỉ transform đúng một lần mỗi frame vào
+    // clipVertices, clip stage chiếu chúng sang transformed, cả pass tô lẫn
+    // pass wireframe đều đọc từ cache đó. Mesh là cube dựng sẵn hoặc file
+    // OBJ/.mesh truyền qua command line (file .mesh được map thẳng vào bộ nhớ)
+    Mesh mesh;
+    glm::mat4 meshFit = glm::mat4(1.0f); // đưa mesh về khối đơn vị ở gốc
+    // Bản SoA của vị trí đỉnh cho batch transform kernel
+    std::vector<float> positionX, positionY, positionZ;
+    bool wireframe = true;
+
+    // Instanced mode: mọi instance dùng chung mesh. Model matrix là world
+    // matrix của node instance trong scene graph (root -> lát z -> instance),
+    // các instance cùng lát nằm liền nhau nên MVP được tính bằng batch kernel
+    // SIMD thẳng trên mảng world. Đỉnh của instance i nằm ở
+    // [i * V, (i + 1) * V) trong clipVertices
+    static constexpr int maxInstances = 100000;
+    static constexpr size_t maxInstanceVertices = 1 << 22;
+    int instanceCount = 0;
+    std::vector<glm::vec3> instanceOffsets; // trong lát của nó
+    std::vector<glm::vec3> instanceAxes;
+    std::vector<float> instanceSpeeds;
+    std::vector<glm::mat4> instanceMVPs;
+
+    // Chỉ những gì di chuyển mới phải tính lại world matrix, MVP và đỉnh
+    SceneGraph scene;
+    SceneGraph::Node sceneRoot = SceneGraph::none;
+    std::vector<SceneGraph::Node> instanceNodes;
+    std::vector<int> nodeInstance; // index node -> instance, -1 nếu không
+    std::vector<int> movingInstances;
+    int movingPercent = 100;
+    std::vector<SceneGraph::Range> changedNodes;
+    std::vector<std::pair<int, int>> dirtyRuns; // instance đầu, số instance
+    std::vector<std::pair<size_t, size_t>> vertexRanges;
+    glm::mat4 lastViewProjection = glm::mat4(0.0f);
+    int lastWidth = 0, lastHeight = 0;
+    size_t worldUpdates = 0;
+    std::vector<Uint32> instanceIndices; // index của mesh lặp lại mỗi instance
+    float sceneRadius = 0.0f;
+    const char* matrixKernelName = "";
+    MatrixBatchFn matrixBatch; // ghi tên kernel vào matrixKernelName
+    const char* vertexKernelName = "";
+    VertexBatchFn vertexBatch;
+    Uint64 transformTicks = 0;
+    int statsFrames = 0;
+
+    std::vector<ClipVertex> clipVertices;
+    std::vector<RasterVertex> transformed;
+    std::vector<Uint32> visibleIndices; // sau culling/clipping
+    std::vector<float> depths;          // mỗi tam giác visible một giá trị
+    std::vector<Uint32> drawIndices;    // triangles theo thứ tự đã sort
+    DepthSorter depthSorter;
+
+    ClipStage clipStage;
+    ClipStats clipStats;
+    Uint64 lastStatsLog = 0;
+
+    // Định nghĩa các mặt của cube (mỗi mặt = 2 tam giác), tất cả quay
+    // ngược chiều kim đồng hồ khi nhìn từ ngoài vào để backface culling
+    // dựa vào winding
+    static constexpr Uint32 faces[12][3] = { // Front face
+                                             { 0, 1, 2 },
+                                             { 2, 3, 0 },
+                                             // Back face
+                                             { 4, 6, 5 },
+                                             { 6, 4, 7 },
+                                             // Left face
+                                             { 7, 0, 3 },
+                                             { 0, 7, 4 },
+                                             // Right face
+                                             { 1, 5, 6 },
+                                             { 6, 2, 1 },
+                                             // Top face
+                                             { 3, 2, 6 },
+                                             { 6, 7, 3 },
+                                             // Bottom face
+                                             { 0, 5, 1 },
+                                             { 5, 0, 4 }
+    };
+
+    // Góc xoay được cập nhật theo bước cố định, Render nội suy giữa hai bước
+    float angle = 0.0f;
+    float previousAngle = 0.0f;
 
     // Định nghĩa các đỉnh của khối lập phương
     void InitializeCube()
     {
-        cubeVertices = {
+        std::vector<Vertex> cubeVertices = {
             // Front face (đỏ)
             { { -0.5f, -0.5f, 0.5f }, { 1.0f, 0.0f, 0.0f } }, // 0
             { { 0.5f, -0.5f, 0.5f }, { 1.0f, 0.0f, 0.0f } },  // 1
@@ -44,108 +130,240 @@ class SimpleCube
             { { 0.5f, 0.5f, -0.5f }, { 0.0f, 1.0f, 0.0f } },   // 6
             { { -0.5f, 0.5f, -0.5f }, { 0.0f, 1.0f, 0.0f } }   // 7
         };
+
+        mesh.Assign(std::move(cubeVertices),
+                    std::vector<Uint32>(&faces[0][0], &faces[0][0] + 12 * 3));
     }
 
-    // Chuyển đổi tọa độ 3D sang 2D với perspective projection
-    glm::vec2 ProjectTo2D(const glm::vec3& point3D, const glm::mat4& mvp)
+    // Load a mesh file, falling back to the built-in cube
+    void InitializeMesh(const char* path)
     {
-        glm::vec4 clipSpace = mvp * glm::vec4(point3D, 1.0f);
-
-        // Perspective divide
-        glm::vec3 ndc = glm::vec3(clipSpace) / clipSpace.w;
-
-        // Viewport transform
-        float x = (ndc.x + 1.0f) * 0.5f * screenWidth;
-        float y = (1.0f - ndc.y) * 0.5f * screenHeight;
+        if (path) {
+            Uint64 start = SDL_GetPerformanceCounter();
+            if (mesh.Load(path)) {
+                SDL_Log("%s: %zu vertices, %zu triangles in %.1f ms",
+                        path,
+                        mesh.VertexCount(),
+                        mesh.TriangleCount(),
+                        (SDL_GetPerformanceCounter() - start) * 1000.0 /
+                          SDL_GetPerformanceFrequency());
+            } else {
+                path = nullptr;
+            }
+        }
+        if (!path)
+            InitializeCube();
+
+        // Scale the longest side of the bounding box to 1, centered
+        glm::vec3 extent = mesh.BoundsMax() - mesh.BoundsMin();
+        float size = std::max({ extent.x, extent.y, extent.z });
+        glm::vec3 center = (mesh.BoundsMin() + mesh.BoundsMax()) * 0.5f;
+        meshFit = glm::scale(glm::mat4(1.0f),
+                             glm::vec3(size > 0.0f ? 1.0f / size : 1.0f));
+        meshFit = glm::translate(meshFit, -center);
+
+        positionX.resize(mesh.VertexCount());
+        positionY.resize(mesh.VertexCount());
+        positionZ.resize(mesh.VertexCount());
+        for (size_t i = 0; i < mesh.VertexCount(); i++) {
+            positionX[i] = mesh.Vertices()[i].position.x;
+            positionY[i] = mesh.Vertices()[i].position.y;
+            positionZ[i] = mesh.Vertices()[i].position.z;
+        }
+    }
 
-        return glm::vec2(x, y);
+    glm::mat4 InstanceLocal(int i, float rotation) const
+    {
+        glm::mat4 local =
+          glm::translate(glm::mat4(1.0f), instanceOffsets[i]);
+        local =
+          glm::rotate(local, rotation * instanceSpeeds[i], instanceAxes[i]);
+        return local * meshFit;
     }
 
-    // Vẽ tam giác với màu đồng nhất
-    void DrawTriangle(const glm::vec2& p1,
-                      const glm::vec2& p2,
-                      const glm::vec2& p3,
-                      const glm::vec3& color)
+    // Gom các node index [begin, end) thành các đoạn instance liên tiếp,
+    // mỗi đoạn tối đa maxRun instance và không vượt qua ranh giới lát
+    void CollectRuns(Uint32 begin, Uint32 end, int maxRun)
     {
-        // Đơn giản hóa: chỉ vẽ outline
-        Uint8 r = (Uint8)(color.r * 255);
-        Uint8 g = (Uint8)(color.g * 255);
-        Uint8 b = (Uint8)(color.b * 255);
+        for (Uint32 j = begin; j < end; j++) {
+            int instance = nodeInstance[j];
+            if (instance < 0)
+                continue;
+            if (!dirtyRuns.empty() && j > begin &&
+                nodeInstance[j - 1] == instance - 1 &&
+                dirtyRuns.back().first + dirtyRuns.back().second ==
+                  instance &&
+                dirtyRuns.back().second < maxRun) {
+                dirtyRuns.back().second++;
+            } else {
+                dirtyRuns.push_back({ instance, 1 });
+            }
+        }
+    }
 
-        SDL_SetRenderDrawColor(renderer, r, g, b, 255);
+    // Animate các node đang chuyển động, cập nhật scene graph rồi tính lại
+    // MVP của những instance có world matrix đổi (hoặc tất cả khi camera,
+    // viewport hay tập instance đổi). dirtyRuns giữ các instance cần
+    // transform lại đỉnh
+    void TransformInstances(const glm::mat4& viewProjection, float rotation)
+    {
+        if (instanceCount > 1 && movingPercent == 100)
+            scene.SetLocal(sceneRoot,
+                           glm::rotate(glm::mat4(1.0f),
+                                       rotation * 0.1f,
+                                       glm::vec3(0.0f, 1.0f, 0.0f)));
+        for (int i : movingInstances)
+            scene.SetLocal(instanceNodes[i], InstanceLocal(i, rotation));
+
+        changedNodes.clear();
+        worldUpdates += scene.Update(&changedNodes);
+
+        bool full =
+          memcmp(&viewProjection, &lastViewProjection, sizeof(glm::mat4)) !=
+            0 ||
+          screenWidth != lastWidth || screenHeight != lastHeight;
+        lastViewProjection = viewProjection;
+        lastWidth = screenWidth;
+        lastHeight = screenHeight;
+        if (full) {
+            changedNodes.clear();
+            changedNodes.push_back({ 0, (Uint32)scene.Size() });
+        }
 
-        // Vẽ 3 cạnh của tam giác
-        SDL_RenderLine(renderer, p1.x, p1.y, p2.x, p2.y);
-        SDL_RenderLine(renderer, p2.x, p2.y, p3.x, p3.y);
-        SDL_RenderLine(renderer, p3.x, p3.y, p1.x, p1.y);
+        const int chunk = 1024;
+        dirtyRuns.clear();
+        for (const SceneGraph::Range& range : changedNodes)
+            CollectRuns(range.first, range.second, chunk);
+
+        const glm::mat4* world = scene.WorldMatrices();
+        pool.ParallelFor(
+          (int)dirtyRuns.size(),
+          [&](int r, int) {
+              int first = dirtyRuns[r].first;
+              matrixBatch(viewProjection,
+                          &world[scene.IndexOf(instanceNodes[first])],
+                          &instanceMVPs[first],
+                          dirtyRuns[r].second);
+          },
+          threadCount);
     }
 
-    // Tạo các tam giác cho khối lập phương
-    void GenerateTriangles(const glm::mat4& mvp)
+    // Transform mỗi đỉnh của mỗi instance trong dirtyRuns đúng một lần vào
+    // post-transform cache: batch kernel ghi clip-space vào clipVertices và
+    // vị trí màn hình vào transformed trong cùng một pass, clip stage khỏi
+    // phải chiếu lại. Đỉnh của instance đứng yên giữ nguyên từ frame trước
+    void TransformVertices()
     {
-        triangles.clear();
-
-        // Định nghĩa các mặt của cube (mỗi mặt = 2 tam giác)
-        int faces[12][3] = { // Front face
-                             { 0, 1, 2 },
-                             { 2, 3, 0 },
-                             // Back face
-                             { 4, 5, 6 },
-                             { 6, 7, 4 },
-                             // Left face
-                             { 7, 3, 0 },
-                             { 0, 4, 7 },
-                             // Right face
-                             { 1, 5, 6 },
-                             { 6, 2, 1 },
-                             // Top face
-                             { 3, 2, 6 },
-                             { 6, 7, 3 },
-                             // Bottom face
-                             { 0, 1, 5 },
-                             { 5, 4, 0 }
-        };
+        const Vertex* vertices = mesh.Vertices();
+        size_t vertexCount = mesh.VertexCount();
+        size_t total = vertexCount * instanceCount;
+        clipVertices.resize(total);
+        transformed.resize(total); // bỏ các đỉnh sinh ra khi clip frame trước
+
+        // Đỉnh của một đoạn instance liên tiếp cũng liên tiếp; chia nhỏ
+        // thành từng khối để mesh lớn vẫn chạy song song
+        const size_t chunk = 16384;
+        vertexRanges.clear();
+        for (const auto& run : dirtyRuns) {
+            size_t end = (size_t)(run.first + run.second) * vertexCount;
+            for (size_t i = (size_t)run.first * vertexCount; i < end;
+                 i += chunk)
+                vertexRanges.push_back({ i, std::min(i + chunk, end) });
+        }
 
-        for (int i = 0; i < 12; i++) {
-            Vertex v1 = cubeVertices[faces[i][0]];
-            Vertex v2 = cubeVertices[faces[i][1]];
-            Vertex v3 = cubeVertices[faces[i][2]];
+        pool.ParallelFor(
+          (int)vertexRanges.size(),
+          [&](int c, int) {
+              size_t end = vertexRanges[c].second;
+              // Mỗi đoạn nằm gọn trong một instance
+              for (size_t i = vertexRanges[c].first; i < end;) {
+                  size_t instance = i / vertexCount;
+                  size_t v = i % vertexCount;
+                  size_t n = std::min(end - i, vertexCount - v);
+                  vertexBatch(instanceMVPs[instance],
+                              &positionX[v],
+                              &positionY[v],
+                              &positionZ[v],
+                              n,
+                              (float)screenWidth,
+                              (float)screenHeight,
+                              &clipVertices[i],
+                              &transformed[i]);
+                  for (size_t k = 0; k < n; k++) {
+                      clipVertices[i + k].color = vertices[v + k].color;
+                      transformed[i + k].color = vertices[v + k].color;
+                  }
+                  i += n;
+              }
+          },
+          threadCount);
+    }
 
-            // Transform vertices
-            glm::vec4 transformedV1 = mvp * glm::vec4(v1.position, 1.0f);
-            glm::vec4 transformedV2 = mvp * glm::vec4(v2.position, 1.0f);
-            glm::vec4 transformedV3 = mvp * glm::vec4(v3.position, 1.0f);
+    // (Re)create the streaming texture the CPU framebuffer is uploaded into
+    bool CreateFrameBuffer()
+    {
+        if (frameBuffer)
+            SDL_DestroyTexture(frameBuffer);
+
+        rasterizer.Resize(screenWidth, screenHeight);
+        frameBuffer = SDL_CreateTexture(renderer,
+                                        SDL_PIXELFORMAT_ARGB8888,
+                                        SDL_TEXTUREACCESS_STREAMING,
+                                        rasterizer.GetWidth(),
+                                        rasterizer.GetHeight());
+        if (!frameBuffer) {
+            std::cerr << "Framebuffer creation failed: " << SDL_GetError()
+                      << std::endl;
+            return false;
+        }
+        return true;
+    }
 
-            // Calculate average depth for sorting
-            float depth =
-              (transformedV1.z + transformedV2.z + transformedV3.z) / 3.0f;
+    // Sort các tam giác còn lại sau culling/clipping theo độ sâu trung
+    // bình (gần trước) và ghi index theo thứ tự đó vào drawIndices
+    void GenerateTriangles()
+    {
+        size_t count = visibleIndices.size() / 3;
+        depths.resize(count);
+        for (size_t t = 0; t < count; t++) {
+            const Uint32* tri = &visibleIndices[t * 3];
+            depths[t] = (transformed[tri[0]].z + transformed[tri[1]].z +
+                         transformed[tri[2]].z) /
+                        3.0f;
+        }
 
-            Triangle tri;
-            tri.v1 = v1;
-            tri.v2 = v2;
-            tri.v3 = v3;
-            tri.depth = depth;
+        const std::vector<Uint32>& order =
+          depthSorter.Sort(depths.data(), count);
 
-            triangles.push_back(tri);
+        drawIndices.resize(count * 3);
+        for (size_t i = 0; i < count; i++) {
+            const Uint32* tri = &visibleIndices[order[i] * 3];
+            drawIndices[i * 3] = tri[0];
+            drawIndices[i * 3 + 1] = tri[1];
+            drawIndices[i * 3 + 2] = tri[2];
         }
-
-        // Sort by depth (front to back)
-        std::sort(triangles.begin(),
-                  triangles.end(),
-                  [](const Triangle& a, const Triangle& b) {
-                      return a.depth < b.depth;
-                  });
     }
 
   public:
-    SimpleCube(int width = 800, int height = 600)
-      : screenWidth(width)
+    SimpleCube(int width = 800,
+               int height = 600,
+               const char* meshPath = nullptr,
+               int instances = 1)
+      : window(nullptr)
+      , renderer(nullptr)
+      , frameBuffer(nullptr)
+      , screenWidth(width)
       , screenHeight(height)
+      , tiled(rasterizer)
+      , threadCount(pool.GetMaxThreads())
+      , matrixBatch(selectMatrixKernel(&matrixKernelName))
+      , vertexBatch(selectVertexKernel(&vertexKernelName))
     {
-        Initialize();
+        if (Initialize(meshPath))
+            SetInstances(instances);
     }
 
-    bool Initialize()
+    bool Initialize(const char* meshPath = nullptr)
     {
         if (!SDL_Init(SDL_INIT_VIDEO)) {
             std::cerr << "SDL Init failed: " << SDL_GetError() << std::endl;
@@ -169,61 +387,184 @@ class SimpleCube
             return false;
         }
 
-        InitializeCube();
+        if (!CreateFrameBuffer())
+            return false;
+
+        InitializeMesh(meshPath);
         return true;
     }
 
-    void Render()
+    // Dàn `count` bản sao của mesh thành lưới lập phương, mỗi bản xoay quanh
+    // trục riêng với tốc độ riêng. Một instance giữ nguyên cube ban đầu
+    void SetInstances(int count)
+    {
+        size_t limit =
+          maxInstanceVertices / std::max<size_t>(1, mesh.VertexCount());
+        count = SDL_clamp(count, 1, (int)SDL_clamp(limit, 1, maxInstances));
+        instanceCount = count;
+        instanceOffsets.resize(count);
+        instanceAxes.resize(count);
+        instanceSpeeds.resize(count);
+        instanceMVPs.resize(count);
+        instanceNodes.resize(count);
+
+        int side = std::max(1, (int)std::cbrt((double)count));
+        while (side * side * side < count)
+            side++;
+        const float spacing = 1.5f;
+        float center = (side - 1) * 0.5f;
+
+        // Thêm node theo thứ tự depth-first: lát z rồi các instance của nó
+        scene.Clear();
+        sceneRoot = scene.Add();
+        SceneGraph::Node slice = SceneGraph::none;
+        for (int i = 0; i < count; i++) {
+            if (i % (side * side) == 0) {
+                float z = (i / (side * side) - center) * spacing;
+                slice = scene.Add(
+                  sceneRoot,
+                  glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, z)));
+            }
+
+            glm::vec3 cell(i % side, (i / side) % side, center);
+            instanceOffsets[i] = (cell - center) * spacing;
+            if (count == 1) {
+                instanceAxes[i] = glm::vec3(1.0f, 1.0f, 0.8f);
+                instanceSpeeds[i] = 1.0f;
+            } else {
+                instanceAxes[i] = glm::normalize(glm::vec3(
+                  SDL_randf() + 0.1f, SDL_randf() - 0.5f, SDL_randf() - 0.5f));
+                instanceSpeeds[i] = 0.5f + SDL_randf();
+            }
+            instanceNodes[i] = scene.Add(slice, InstanceLocal(i, angle));
+        }
+        sceneRadius = count == 1 ? 0.0f : side * spacing * 0.87f;
+
+        nodeInstance.assign(scene.Size(), -1);
+        for (int i = 0; i < count; i++)
+            nodeInstance[scene.IndexOf(instanceNodes[i])] = i;
+        SetMovingPercent(movingPercent);
+        lastWidth = 0; // tính lại toàn bộ ở frame sau
+
+        instanceIndices.clear();
+        if (count > 1) {
+            Uint32 vertexCount = (Uint32)mesh.VertexCount();
+            instanceIndices.resize(mesh.IndexCount() * count);
+            for (int i = 0; i < count; i++)
+                for (size_t k = 0; k < mesh.IndexCount(); k++)
+                    instanceIndices[i * mesh.IndexCount() + k] =
+                      mesh.Indices()[k] + i * vertexCount;
+        }
+
+        // Wireframe vẽ từng cạnh bằng SDL_RenderLine, chỉ hợp với mesh nhỏ
+        wireframe = mesh.TriangleCount() * count <= 4096;
+        SDL_Log("instances: %d (%s matrix, %s vertex kernel)",
+                count,
+                matrixKernelName,
+                vertexKernelName);
+    }
+
+    // Chỉ khoảng `percent`% instance tự xoay; ở 100% cả cảnh còn quay quanh
+    // trục y qua node gốc, nên mọi world matrix đều phải tính lại
+    void SetMovingPercent(int percent)
+    {
+        movingPercent = percent;
+        movingInstances.clear();
+        for (int i = 0; i < instanceCount; i++)
+            if ((i * 37) % 100 < percent)
+                movingInstances.push_back(i);
+        scene.SetLocal(sceneRoot, glm::mat4(1.0f));
+    }
+
+    // 100, 10, 1, 0 rồi quay lại 100
+    void CycleMovingPercent()
+    {
+        SetMovingPercent(movingPercent == 0 ? 100 : movingPercent / 10);
+        SDL_Log("moving: %d%% of %d instances", movingPercent, instanceCount);
+    }
+
+    // 1, 1k, 10k, 100k rồi quay lại 1
+    void CycleInstances()
+    {
+        SetInstances(instanceCount >= maxInstances ? 1
+                     : instanceCount == 1          ? 1000
+                                                   : instanceCount * 10);
+    }
+
+    void Update(float dt)
+    {
+        previousAngle = angle;
+        angle += dt * 0.5f;
+    }
+
+    void Render(float alpha)
     {
         // Clear screen
         SDL_SetRenderDrawColor(renderer, 30, 30, 30, 255);
         SDL_RenderClear(renderer);
 
         // Tạo transformation matrices với GLM
-        glm::mat4 model = glm::mat4(1.0f);
         glm::mat4 view = glm::mat4(1.0f);
         glm::mat4 projection = glm::mat4(1.0f);
 
         // Xoay cube theo thời gian
-        float time = SDL_GetTicks() / 1000.0f;
-        model = glm::rotate(model, time * 0.5f, glm::vec3(1.0f, 1.0f, 0.8f));
+        float rotation = previousAngle + (angle - previousAngle) * alpha;
 
-        // Đặt camera
-        view = glm::translate(view, glm::vec3(0.0f, 0.0f, -3.0f));
+        // Đặt camera, lùi ra xa đủ để thấy cả lưới instance
+        float distance = std::max(3.0f, sceneRadius * 3.0f);
+        view = glm::translate(view, glm::vec3(0.0f, 0.0f, -distance));
 
         // Tạo perspective projection
-        projection = glm::perspective(glm::radians(40.0f),
-                                      (float)screenWidth / (float)screenHeight,
-                                      0.1f,
-                                      50.0f);
-
-        // Model-View-Projection matrix
-        glm::mat4 mvp = projection * view * model;
-
-        // Generate và sort triangles
-        GenerateTriangles(mvp);
-
-        // Vẽ tất cả triangles
-        for (const auto& triangle : triangles) {
-            glm::vec2 p1 = ProjectTo2D(triangle.v1.position, mvp);
-            glm::vec2 p2 = ProjectTo2D(triangle.v2.position, mvp);
-            glm::vec2 p3 = ProjectTo2D(triangle.v3.position, mvp);
-
-            // Sử dụng màu trung bình của 3 đỉnh
-            glm::vec3 avgColor =
-              (triangle.v1.color + triangle.v2.color + triangle.v3.color) /
-              3.0f;
-
-            DrawTriangle(p1, p2, p3, avgColor);
+        projection =
+          glm::perspective(glm::radians(40.0f),
+                           (float)screenWidth / (float)screenHeight,
+                           0.1f,
+                           std::max(50.0f, distance + sceneRadius * 2.0f));
+
+        // Transform, cull/clip, generate và sort triangles
+        Uint64 transformStart = SDL_GetPerformanceCounter();
+        TransformInstances(projection * view, rotation);
+        TransformVertices();
+        transformTicks += SDL_GetPerformanceCounter() - transformStart;
+        statsFrames++;
+
+        const Uint32* indices = mesh.Indices();
+        size_t indexCount = mesh.IndexCount();
+        if (instanceCount > 1) {
+            indices = instanceIndices.data();
+            indexCount = instanceIndices.size();
+        }
+        clipStage.Process(clipVertices,
+                          indices,
+                          indexCount,
+                          screenWidth,
+                          screenHeight,
+                          transformed,
+                          visibleIndices,
+                          clipStats,
+                          true);
+        GenerateTriangles();
+        LogClipStats();
+
+        // Rasterize tất cả triangles rồi upload framebuffer một lần
+        tiled.Render(pool, transformed, drawIndices, 0xFF1E1E1E, threadCount);
+
+        if (frameBuffer) {
+            SDL_UpdateTexture(frameBuffer,
+                              NULL,
+                              rasterizer.GetPixels(),
+                              rasterizer.GetPitch());
+            SDL_RenderTexture(renderer, frameBuffer, NULL, NULL);
         }
 
         // Vẽ wireframe với độ mờ dần theo depth
-        for (int i = 0; i < triangles.size(); i++) {
-            const auto& triangle = triangles[i];
+        int triangleCount = (int)drawIndices.size() / 3;
+        for (int i = 0; wireframe && i < triangleCount; i++) {
+            const Uint32* triangle = &drawIndices[i * 3];
 
             // Cạnh ở gần (đầu danh sách) sẽ sáng, cạnh xa (cuối danh sách) sẽ
             // tối
-            float depthFactor = (float)i / (float)triangles.size(); // Đảo ngược
+            float depthFactor = (float)i / (float)triangleCount; // Đảo ngược
             Uint8 alpha = (Uint8)((1.0f - depthFactor) * 120 +
                                   30); // Gần = mờ ít, xa = mờ nhiều
             Uint8 brightness =
@@ -232,9 +573,9 @@ class SimpleCube
             SDL_SetRenderDrawColor(
               renderer, brightness, brightness, brightness, alpha);
 
-            glm::vec2 p1 = ProjectTo2D(triangle.v1.position, mvp);
-            glm::vec2 p2 = ProjectTo2D(triangle.v2.position, mvp);
-            glm::vec2 p3 = ProjectTo2D(triangle.v3.position, mvp);
+            const RasterVertex& p1 = transformed[triangle[0]];
+            const RasterVertex& p2 = transformed[triangle[1]];
+            const RasterVertex& p3 = transformed[triangle[2]];
 
             SDL_RenderLine(renderer, p1.x, p1.y, p2.x, p2.y);
             SDL_RenderLine(renderer, p2.x, p2.y, p3.x, p3.y);
@@ -244,14 +585,71 @@ class SimpleCube
         SDL_RenderPresent(renderer);
     }
 
+    void LogClipStats()
+    {
+        Uint64 now = SDL_GetTicks();
+        if (now - lastStatsLog < 1000)
+            return;
+        double seconds = (now - lastStatsLog) / 1000.0;
+        lastStatsLog = now;
+
+        SDL_Log("instances: %d, %.0f instances/s, transform %.2f ms/frame",
+                instanceCount,
+                instanceCount * statsFrames / seconds,
+                transformTicks * 1000.0 / SDL_GetPerformanceFrequency() /
+                  std::max(statsFrames, 1));
+        SDL_Log("scene: %zu nodes, %d%% moving, %.0f world updates/frame",
+                scene.Size(),
+                movingPercent,
+                (double)worldUpdates / std::max(statsFrames, 1));
+        transformTicks = 0;
+        worldUpdates = 0;
+        statsFrames = 0;
+        SDL_Log("triangles: %d in, %d backface, %d outside, %d clipped, %d out",
+                clipStats.input,
+                clipStats.culledBackface,
+                clipStats.culledOutside,
+                clipStats.clipped,
+                clipStats.output);
+        SDL_Log("depth sort: %d radix, %d coherent frames",
+                depthSorter.GetRadixFrames(),
+                depthSorter.GetCoherentFrames());
+    }
+
+    void ToggleBackfaceCulling()
+    {
+        clipStage.cullBackfaces = !clipStage.cullBackfaces;
+        SDL_Log("backface culling: %s",
+                clipStage.cullBackfaces ? "on" : "off");
+    }
+
+    void ToggleWireframe()
+    {
+        wireframe = !wireframe;
+        SDL_Log("wireframe: %s", wireframe ? "on" : "off");
+    }
+
+    // 1, 2, 4, ... tới số thread tối đa của pool rồi quay lại 1
+    void CycleThreads()
+    {
+        threadCount = threadCount >= pool.GetMaxThreads()
+                        ? 1
+                        : std::min(threadCount * 2, pool.GetMaxThreads());
+        SDL_Log("raster threads: %d", threadCount);
+    }
+
     void HandleResize(int width, int height)
     {
         screenWidth = width;
         screenHeight = height;
+        CreateFrameBuffer();
     }
 
     void Cleanup()
     {
+        if (frameBuffer)
+            SDL_DestroyTexture(frameBuffer);
+        frameBuffer = nullptr;
         if (renderer)
             SDL_DestroyRenderer(renderer);
         if (window)
@@ -262,16 +660,267 @@ class SimpleCube
     ~SimpleCube() { Cleanup(); }
 };
 
+// --bench-threads: rasterize a ~100k triangle sphere offscreen at 1080p with
+// 1/2/4/8 threads and report ms/frame and speedup
+static void
+BenchThreads()
+{
+    const int width = 1920, height = 1080, frames = 30;
+    std::vector<Vertex> sphere;
+    std::vector<Uint32> indices;
+    MakeSphere(160, 320, sphere, indices);
+
+    glm::mat4 model = glm::scale(glm::mat4(1.0f), glm::vec3(2.2f));
+    glm::mat4 view =
+      glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -3.0f));
+    glm::mat4 projection = glm::perspective(
+      glm::radians(40.0f), (float)width / (float)height, 0.1f, 50.0f);
+    glm::mat4 mvp = projection * view * model;
+
+    std::vector<RasterVertex> vertices(sphere.size());
+    for (size_t i = 0; i < sphere.size(); i++)
+        vertices[i] = ClipStage::Project(
+          { mvp * glm::vec4(sphere[i].position, 1.0f), sphere[i].color },
+          width,
+          height);
+
+    SoftRasterizer target;
+    target.Resize(width, height);
+    TiledRasterizer tiled(target);
+    ThreadPool pool(std::max(8, SDL_GetNumLogicalCPUCores()));
+
+    std::cout << indices.size() / 3 << " triangles, " << width << "x" << height
+              << std::endl;
+    double baseline = 0.0;
+    for (int threads : { 1, 2, 4, 8 }) {
+        tiled.Render(pool, vertices, indices, 0xFF1E1E1E, threads); // warm up
+
+        Uint64 start = SDL_GetPerformanceCounter();
+        for (int i = 0; i < frames; i++)
+            tiled.Render(pool, vertices, indices, 0xFF1E1E1E, threads);
+        double ms = (SDL_GetPerformanceCounter() - start) * 1000.0 /
+                    SDL_GetPerformanceFrequency() / frames;
+        if (threads == 1)
+            baseline = ms;
+
+        std::cout << threads << " threads: " << ms << " ms/frame, speedup "
+                  << baseline / ms << "x" << std::endl;
+    }
+}
+
+// --bench-sort: depth-order 1k/100k/1M triangles with the old std::sort over
+// Triangle structs, a cold radix sort, and the radix sorter fed slowly
+// drifting depths as in consecutive frames
+static void
+BenchSort()
+{
+    struct Triangle
+    {
+        Uint32 index[3];
+        float depth;
+    };
+
+    auto elapsed = [](Uint64 start) {
+        return (SDL_GetPerformanceCounter() - start) * 1000.0 /
+               SDL_GetPerformanceFrequency();
+    };
+
+    for (size_t count : { 1000u, 100000u, 1000000u }) {
+        const int frames = 20;
+        std::vector<float> depths(count);
+        for (float& d : depths)
+            d = SDL_randf() * 2.0f - 1.0f;
+
+        std::vector<Triangle> triangles(count);
+        double sortMs = 0.0;
+        for (int f = 0; f < frames; f++) {
+            for (size_t i = 0; i < count; i++)
+                triangles[i] = { { (Uint32)i, 0, 0 }, depths[i] };
+            Uint64 start = SDL_GetPerformanceCounter();
+            std::sort(triangles.begin(),
+                      triangles.end(),
+                      [](const Triangle& a, const Triangle& b) {
+                          return a.depth < b.depth;
+                      });
+            sortMs += elapsed(start);
+        }
+
+        DepthSorter sorter;
+        double radixMs = 0.0;
+        for (int f = 0; f < frames; f++) {
+            sorter.Reset();
+            Uint64 start = SDL_GetPerformanceCounter();
+            sorter.Sort(depths.data(), count);
+            radixMs += elapsed(start);
+        }
+
+        // Verify against std::sort on the same keys
+        const std::vector<Uint32>& order = sorter.Sort(depths.data(), count);
+        for (size_t i = 0; i < count; i++) {
+            if (depths[order[i]] != triangles[i].depth) {
+                std::cout << "radix order mismatch at " << i << std::endl;
+                return;
+            }
+        }
+
+        int coherentBefore = sorter.GetCoherentFrames();
+        double coherentMs = 0.0;
+        for (int f = 0; f < frames; f++) {
+            for (float& d : depths)
+                d += (SDL_randf() - 0.5f) * 1e-5f;
+            Uint64 start = SDL_GetPerformanceCounter();
+            sorter.Sort(depths.data(), count);
+            coherentMs += elapsed(start);
+        }
+
+        std::cout << count << " triangles: std::sort " << sortMs / frames
+                  << " ms, radix " << radixMs / frames << " ms, coherent "
+                  << coherentMs / frames << " ms ("
+                  << sorter.GetCoherentFrames() - coherentBefore << "/"
+                  << frames << " insertion-sorted)" << std::endl;
+    }
+}
+
+// --verify-transform: run every vertex kernel the CPU supports against glm
+// plus ClipStage::Project on random positions and report the largest
+// difference and the time per million vertices, streaming and with the data
+// in cache. Returns false on mismatch.
+static bool
+VerifyTransform()
+{
+    const size_t count = 1000003; // not a multiple of 8, covers the tail
+    const float width = 1920.0f, height = 1080.0f;
+    std::vector<float> x(count), y(count), z(count);
+    for (size_t i = 0; i < count; i++) {
+        x[i] = SDL_randf() * 2.0f - 1.0f;
+        y[i] = SDL_randf() * 2.0f - 1.0f;
+        z[i] = SDL_randf() * 2.0f - 1.0f;
+    }
+
+    glm::mat4 model =
+      glm::rotate(glm::mat4(1.0f), 0.7f, glm::vec3(1.0f, 1.0f, 0.8f));
+    glm::mat4 view =
+      glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -3.0f));
+    glm::mat4 mvp =
+      glm::perspective(glm::radians(40.0f), width / height, 0.1f, 50.0f) *
+      view * model;
+
+    std::vector<ClipVertex> expectedClip(count), clip(count);
+    std::vector<RasterVertex> expectedScreen(count), screen(count);
+    for (size_t i = 0; i < count; i++) {
+        expectedClip[i].position = mvp * glm::vec4(x[i], y[i], z[i], 1.0f);
+        expectedScreen[i] =
+          ClipStage::Project(expectedClip[i], (int)width, (int)height);
+    }
+
+    struct
+    {
+        const char* name;
+        VertexBatchFn fn;
+        bool supported;
+    } kernels[] = {
+        { "scalar", vertexBatchScalar, true },
+#ifdef TRANSFORM_KERNEL_X86
+        { "sse2", vertexBatchSSE2, SDL_HasSSE2() },
+        { "avx", vertexBatchAVX, SDL_HasAVX() },
+#endif
+    };
+
+    bool ok = true;
+    for (const auto& kernel : kernels) {
+        if (!kernel.supported)
+            continue;
+        Uint64 start = SDL_GetPerformanceCounter();
+        kernel.fn(mvp,
+                  x.data(),
+                  y.data(),
+                  z.data(),
+                  count,
+                  width,
+                  height,
+                  clip.data(),
+                  screen.data());
+        double ms = (SDL_GetPerformanceCounter() - start) * 1000.0 /
+                    SDL_GetPerformanceFrequency();
+
+        float clipError = 0.0f, screenError = 0.0f;
+        for (size_t i = 0; i < count; i++) {
+            for (int k = 0; k < 4; k++)
+                clipError =
+                  std::max(clipError,
+                           SDL_fabsf(clip[i].position[k] -
+                                     expectedClip[i].position[k]));
+            const RasterVertex& a = screen[i];
+            const RasterVertex& b = expectedScreen[i];
+            screenError = std::max({ screenError,
+                                     SDL_fabsf(a.x - b.x),
+                                     SDL_fabsf(a.y - b.y),
+                                     SDL_fabsf(a.z - b.z),
+                                     SDL_fabsf(a.invW - b.invW) });
+        }
+
+        // Lặp lại trên một đoạn nằm gọn trong cache để đo phần tính toán
+        const size_t hot = 16384;
+        const int repeats = 200;
+        start = SDL_GetPerformanceCounter();
+        for (int r = 0; r < repeats; r++)
+            kernel.fn(mvp,
+                      x.data(),
+                      y.data(),
+                      z.data(),
+                      hot,
+                      width,
+                      height,
+                      clip.data(),
+                      screen.data());
+        double hotMs = (SDL_GetPerformanceCounter() - start) * 1000.0 /
+                       SDL_GetPerformanceFrequency();
+
+        bool pass = clipError <= 1e-5f && screenError <= 1e-3f;
+        ok = ok && pass;
+        std::cout << kernel.name << ": " << ms * 1e6 / count
+                  << " ms per million vertices (" << hotMs * 1e6 / hot / repeats
+                  << " in cache), max error clip " << clipError << " screen "
+                  << screenError << (pass ? "" : "  FAILED") << std::endl;
+    }
+    return ok;
+}
+
 int
 main(int argc, char* argv[])
 {
-    SimpleCube cube(800, 600);
+    const char* meshPath = nullptr;
+    int instances = 1;
+    for (int i = 1; i < argc; i++) {
+        if (SDL_strcmp(argv[i], "--bench-threads") == 0) {
+            BenchThreads();
+            return 0;
+        }
+        if (SDL_strcmp(argv[i], "--bench-sort") == 0) {
+            BenchSort();
+            return 0;
+        }
+        if (SDL_strcmp(argv[i], "--verify-transform") == 0)
+            return VerifyTransform() ? 0 : 1;
+        if (SDL_strcmp(argv[i], "--instances") == 0 && i + 1 < argc) {
+            instances = SDL_atoi(argv[++i]);
+            continue;
+        }
+        meshPath = argv[i];
+    }
+
+    SimpleCube cube(800, 600, meshPath, instances);
+    FrameScheduler scheduler("cube", 60.0, 120.0);
+    InputPump input("cube");
 
     bool running = true;
-    SDL_Event event;
 
     while (running) {
-        while (SDL_PollEvent(&event)) {
+        int steps = scheduler.beginFrame();
+
+        // Kéo cửa sổ bắn hàng loạt resize, chỉ cái cuối mỗi frame còn lại
+        input.poll();
+        for (const SDL_Event& event : input.drain()) {
             switch (event.type) {
                 case SDL_EVENT_QUIT:
                     running = false;
@@ -281,6 +930,21 @@ main(int argc, char* argv[])
                     if (event.key.key == SDLK_ESCAPE) {
                         running = false;
                     }
+                    if (event.key.key == SDLK_T) {
+                        cube.CycleThreads();
+                    }
+                    if (event.key.key == SDLK_C) {
+                        cube.ToggleBackfaceCulling();
+                    }
+                    if (event.key.key == SDLK_W) {
+                        cube.ToggleWireframe();
+                    }
+                    if (event.key.key == SDLK_N) {
+                        cube.CycleInstances();
+                    }
+                    if (event.key.key == SDLK_M) {
+                        cube.CycleMovingPercent();
+                    }
 
                     break;
 
@@ -290,8 +954,11 @@ main(int argc, char* argv[])
             }
         }
 
-        cube.Render();
-        // SDL_Delay(16); // ~60 FPS
+        for (int i = 0; i < steps; i++)
+            cube.Update(scheduler.getStep());
+        cube.Render(scheduler.getAlpha());
+        input.presented();
+        scheduler.endFrame();
     }
 
     return 0;
@@ -1,6 +1,11 @@
 #define SDL_MAIN_USE_CALLBACKS 1 /* use the callbacks instead of main() */
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_main.h>
+#include "atlas_cache.h"
+#include "input_pump.h"
+#include "retained_layer.h"
+#include "sprite_batch.h"
+#include <vector>
 
 /* We will use this renderer to draw into this window every frame. */
 static SDL_Window* window = NULL;
@@ -9,15 +14,125 @@ static SDL_Texture* texture = NULL;
 static int texture_width = 0;
 static int texture_height = 0;
 
+/* Every image comes from the atlas packed at build time (atlaspack): one
+   decode and one upload per atlas page, sprites are sub-rects of it. */
+static AtlasCache* atlas = NULL;
+static SDL_FRect sample_src;
+
+/* Every sprite this frame goes through the batch: one SDL_RenderGeometry
+   call per texture instead of one SDL_RenderTexture per sprite. */
+static SpriteBatch* batch = NULL;
+
+/* The sky and ground never change: they are drawn once into the layer's
+   background and each frame only the rectangles the four sprites left or
+   entered are recomposed (the whole window in stress mode). */
+static RetainedLayer* layer = NULL;
+static SDL_FRect sprite_rects[4];
+static SDL_FRect drawn_rects[4]; /* where they were last presented */
+
+/* Events are queued by SDL_AppEvent and handled, coalesced, at the start
+   of the next frame; it also measures input-to-present latency. */
+static InputPump* input = NULL;
+
+/* Stress mode (--stress [N], S toggles): N copies of the texture bouncing
+   around, stored as parallel arrays. */
+#define DEFAULT_STRESS_SPRITES 100000
+static bool stress = false;
+static int stress_count = DEFAULT_STRESS_SPRITES;
+static std::vector<float> sprite_x, sprite_y, sprite_vx, sprite_vy;
+static std::vector<float> sprite_angle, sprite_spin, sprite_scale;
+static std::vector<SDL_FColor> sprite_tint;
+static Uint64 last_frame_ns = 0;
+
+/* Per-second report */
+static Uint64 stats_start_ns = 0;
+static int stats_frames = 0;
+static int stats_sprites = 0;
+static int stats_draw_calls = 0;
+static Uint64 stats_build_ns = 0;
+
 #define WINDOW_WIDTH 1360
 #define WINDOW_HEIGHT 768
 
+static void
+init_stress_sprites(int count)
+{
+    sprite_x.resize(count);
+    sprite_y.resize(count);
+    sprite_vx.resize(count);
+    sprite_vy.resize(count);
+    sprite_angle.resize(count);
+    sprite_spin.resize(count);
+    sprite_scale.resize(count);
+    sprite_tint.resize(count);
+    for (int i = 0; i < count; i++) {
+        sprite_x[i] = SDL_randf() * WINDOW_WIDTH;
+        sprite_y[i] = SDL_randf() * WINDOW_HEIGHT;
+        sprite_vx[i] = (SDL_randf() - 0.5f) * 400.0f; /* pixels per second */
+        sprite_vy[i] = (SDL_randf() - 0.5f) * 400.0f;
+        sprite_angle[i] = SDL_randf() * 2.0f * SDL_PI_F;
+        sprite_spin[i] = (SDL_randf() - 0.5f) * 4.0f; /* radians per second */
+        sprite_scale[i] = 0.05f + SDL_randf() * 0.15f;
+        sprite_tint[i] = { 0.5f + SDL_randf() * 0.5f,
+                           0.5f + SDL_randf() * 0.5f,
+                           0.5f + SDL_randf() * 0.5f,
+                           1.0f };
+    }
+}
+
+static void
+update_stress_sprites(float dt)
+{
+    for (int i = 0; i < stress_count; i++) {
+        sprite_x[i] += sprite_vx[i] * dt;
+        sprite_y[i] += sprite_vy[i] * dt;
+        sprite_angle[i] += sprite_spin[i] * dt;
+        if ((sprite_x[i] < 0.0f && sprite_vx[i] < 0.0f) ||
+            (sprite_x[i] > WINDOW_WIDTH && sprite_vx[i] > 0.0f))
+            sprite_vx[i] = -sprite_vx[i];
+        if ((sprite_y[i] < 0.0f && sprite_vy[i] < 0.0f) ||
+            (sprite_y[i] > WINDOW_HEIGHT && sprite_vy[i] > 0.0f))
+            sprite_vy[i] = -sprite_vy[i];
+    }
+}
+
+static void
+report_stats(Uint64 now_ns)
+{
+    stats_frames++;
+    stats_sprites += batch->getSpriteCount();
+    stats_draw_calls += batch->getDrawCalls();
+    batch->resetStats();
+
+    if (now_ns - stats_start_ns < SDL_NS_PER_SECOND)
+        return;
+    double seconds = (double)(now_ns - stats_start_ns) / SDL_NS_PER_SECOND;
+    SDL_Log("sprites: %d/frame in %.1f draw calls, %.1f fps, batch build "
+            "%.2f ms/frame",
+            stats_sprites / stats_frames,
+            (double)stats_draw_calls / stats_frames,
+            stats_frames / seconds,
+            (double)stats_build_ns / SDL_NS_PER_MS / stats_frames);
+    stats_start_ns = now_ns;
+    stats_frames = 0;
+    stats_sprites = 0;
+    stats_draw_calls = 0;
+    stats_build_ns = 0;
+}
+
 /* This function runs once at startup. */
 SDL_AppResult
 SDL_AppInit(void** appstate, int argc, char* argv[])
 {
-    SDL_Surface* surface = NULL;
-    char* bmp_path = NULL;
+    char* images_path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (SDL_strcmp(argv[i], "--stress") == 0) {
+            stress = true;
+            if (i + 1 < argc && SDL_atoi(argv[i + 1]) > 0)
+                stress_count = SDL_atoi(argv[++i]);
+        }
+    }
 
     SDL_SetAppMetadata(
       "Example Renderer Textures", "1.0", "com.example.renderer-textures");
@@ -43,33 +158,42 @@ SDL_AppInit(void** appstate, int argc, char* argv[])
        file. */
 
     /* SDL_Surface is pixel data the CPU can access. SDL_Texture is pixel data
-       the GPU can access. Load a .bmp into a surface, move it to a texture from
-       there. */
+       the GPU can access. The build packs every image into atlas pages;
+       load them once and look the sprite up by its file name. */
     SDL_asprintf(
-      &bmp_path,
-      "%simages/sample.bmp",
-      SDL_GetBasePath()); /* allocate a string of the full file path */
+      &images_path,
+      "%simages/",
+      SDL_GetBasePath()); /* allocate a string of the full directory path */
 
     SDL_Log("base path: %s", SDL_GetBasePath());
-    surface = SDL_LoadBMP(bmp_path);
-    if (!surface) {
-        SDL_Log("Couldn't load bitmap: %s", SDL_GetError());
+    const Uint64 atlas_start = SDL_GetTicksNS();
+    atlas = new AtlasCache();
+    if (!atlas->load(renderer, images_path)) {
+        SDL_Log("Couldn't load atlas: %s", SDL_GetError());
+        SDL_free(images_path);
         return SDL_APP_FAILURE;
     }
+    SDL_free(images_path); /* done with this, the atlas is loaded. */
+    SDL_Log("atlas: %d sprites on %d page(s) loaded in %.2f ms",
+            (int)atlas->getSpriteCount(),
+            (int)atlas->getPageCount(),
+            (SDL_GetTicksNS() - atlas_start) / 1e6);
 
-    SDL_free(bmp_path); /* done with this, the file is loaded. */
-
-    texture_width = surface->w;
-    texture_height = surface->h;
-
-    texture = SDL_CreateTextureFromSurface(renderer, surface);
-    if (!texture) {
-        SDL_Log("Couldn't create static texture: %s", SDL_GetError());
+    const AtlasSprite* sample = atlas->get("sample");
+    if (!sample) {
+        SDL_Log("Couldn't find sprite 'sample' in the atlas");
         return SDL_APP_FAILURE;
     }
+    texture = sample->texture;
+    sample_src = sample->src;
+    texture_width = (int)sample_src.w;
+    texture_height = (int)sample_src.h;
 
-    SDL_DestroySurface(
-      surface); /* done with this, the texture has a copy of the pixels now. */
+    batch = new SpriteBatch(renderer);
+    layer = new RetainedLayer(renderer);
+    input = new InputPump("cute");
+    init_stress_sprites(stress_count);
+    last_frame_ns = stats_start_ns = SDL_GetTicksNS();
 
     return SDL_APP_CONTINUE; /* carry on with the program! */
 }
@@ -82,20 +206,31 @@ SDL_AppEvent(void* appstate, SDL_Event* event)
         return SDL_APP_SUCCESS; /* end the program, reporting success to the OS.
                                  */
     }
+    input->push(event);
     return SDL_APP_CONTINUE; /* carry on with the program! */
 }
 
-/* This function runs once per frame, and is the heart of the program. */
-SDL_AppResult
-SDL_AppIterate(void* appstate)
+/* Events queued since the last frame, run from SDL_AppIterate. */
+static void
+handle_event(const SDL_Event* event)
+{
+    layer->handleEvent(event);
+    if (event->type == SDL_EVENT_KEY_DOWN && event->key.key == SDLK_S) {
+        stress = !stress;
+        layer->invalidateAll(); /* erase or bring back the whole swarm */
+        SDL_Log("stress mode: %s (%d sprites)",
+                stress ? "on" : "off",
+                stress_count);
+    }
+}
+
+/* Static part of the scene, only drawn when the layer's background target
+   was invalidated. */
+static void
+draw_background(void)
 {
     SDL_FRect dst_rect;
-    const Uint64 now = SDL_GetTicks();
 
-    /* we'll have some textures move around over a few seconds. */
-    const float direction = ((now % 4000) >= 2000) ? 1.0f : -1.0f;
-    const float scale =
-      ((float)(((int)(now % 2000)) - 1000) / 999.0f) * direction;
     /* as you can see from this, rendering draws over whatever was drawn before
      * it. */
     SDL_SetRenderDrawColor(
@@ -108,45 +243,103 @@ SDL_AppIterate(void* appstate)
     dst_rect.w = WINDOW_WIDTH;
     dst_rect.h = WINDOW_HEIGHT * 2.0 / 3.0;
     SDL_RenderFillRect(renderer, &dst_rect);
+}
 
+/* Everything that moves; called once per dirty rectangle, clipped to it. */
+static void
+draw_foreground(void)
+{
     /* Just draw the static texture a few times. You can think of
        it like a stamp, there isn't a limit to the number of
-       times you can draw with it.
+       times you can draw with it. The batch only records the quads;
+       they all reach the renderer in one call at flush().
      */
+    const Uint64 build_start = SDL_GetTicksNS();
+
+    for (int i = 0; i < (int)SDL_arraysize(sprite_rects); i++)
+        batch->draw(
+          texture, sprite_rects[i], 0.0f, SpriteBatch::white, &sample_src);
+
+    if (stress) {
+        for (int i = 0; i < stress_count; i++)
+            batch->draw(texture,
+                        sample_src,
+                        sprite_x[i],
+                        sprite_y[i],
+                        sprite_scale[i],
+                        sprite_angle[i],
+                        sprite_tint[i]);
+    }
+    stats_build_ns += SDL_GetTicksNS() - build_start;
+
+    batch->flush();
+}
+
+/* This function runs once per frame, and is the heart of the program. */
+SDL_AppResult
+SDL_AppIterate(void* appstate)
+{
+    SDL_FRect* dst_rect;
+    const Uint64 now = SDL_GetTicks();
+    const Uint64 now_ns = SDL_GetTicksNS();
+    const float dt = (float)(now_ns - last_frame_ns) / SDL_NS_PER_SECOND;
+    last_frame_ns = now_ns;
+
+    for (const SDL_Event& event : input->drain())
+        handle_event(&event);
+
+    /* we'll have some textures move around over a few seconds. */
+    const float direction = ((now % 4000) >= 2000) ? 1.0f : -1.0f;
+    const float scale =
+      ((float)(((int)(now % 2000)) - 1000) / 999.0f) * direction;
 
     /* top left */
-    dst_rect.x = 0.0f;
-    dst_rect.y = 100 * scale + 100;
-    dst_rect.w = (float)texture_width;
-    dst_rect.h = (float)texture_height;
-    SDL_RenderTexture(renderer, texture, NULL, &dst_rect);
+    dst_rect = &sprite_rects[0];
+    dst_rect->x = 0.0f;
+    dst_rect->y = 100 * scale + 100;
+    dst_rect->w = (float)texture_width;
+    dst_rect->h = (float)texture_height;
 
     /* center this one. */
-    dst_rect.x =
+    dst_rect = &sprite_rects[1];
+    dst_rect->x =
       (WINDOW_WIDTH - texture_width) / 2.0f + 100.0f * SDL_sin(now / 1000.0f);
-    dst_rect.y =
+    dst_rect->y =
       (WINDOW_HEIGHT - texture_height) / 2.0f + 100.0f * SDL_cos(now / 1000.0f);
-    dst_rect.w = (float)texture_width / 2;
-    dst_rect.h = (float)texture_height / 2;
-    SDL_RenderTexture(renderer, texture, NULL, &dst_rect);
-
-    dst_rect.x = (WINDOW_WIDTH - texture_width) / 2.0f +
-                 100.0f * SDL_sin(now / 1000.0f + SDL_PI_F);
-    dst_rect.y = (WINDOW_HEIGHT - texture_height) / 2.0f +
-                 100.0f * SDL_cos(now / 1000.0f + SDL_PI_F);
-    dst_rect.w = (float)texture_width / 2;
-    dst_rect.h = (float)texture_height / 2;
-    SDL_RenderTexture(renderer, texture, NULL, &dst_rect);
+    dst_rect->w = (float)texture_width / 2;
+    dst_rect->h = (float)texture_height / 2;
+
+    dst_rect = &sprite_rects[2];
+    dst_rect->x = (WINDOW_WIDTH - texture_width) / 2.0f +
+                  100.0f * SDL_sin(now / 1000.0f + SDL_PI_F);
+    dst_rect->y = (WINDOW_HEIGHT - texture_height) / 2.0f +
+                  100.0f * SDL_cos(now / 1000.0f + SDL_PI_F);
+    dst_rect->w = (float)texture_width / 2;
+    dst_rect->h = (float)texture_height / 2;
 
     /* bottom right. */
-    dst_rect.x =
+    dst_rect = &sprite_rects[3];
+    dst_rect->x =
       (float)(WINDOW_WIDTH - texture_width) - (100.0f * scale) - 100.0;
-    dst_rect.y = (float)(WINDOW_HEIGHT - texture_height);
-    dst_rect.w = (float)texture_width;
-    dst_rect.h = (float)texture_height;
-    SDL_RenderTexture(renderer, texture, NULL, &dst_rect);
+    dst_rect->y = (float)(WINDOW_HEIGHT - texture_height);
+    dst_rect->w = (float)texture_width;
+    dst_rect->h = (float)texture_height;
 
-    SDL_RenderPresent(renderer); /* put it all on the screen! */
+    /* only where a sprite was or is now needs recomposing */
+    for (int i = 0; i < (int)SDL_arraysize(sprite_rects); i++)
+        layer->move(drawn_rects[i], sprite_rects[i]);
+
+    if (stress) {
+        update_stress_sprites(dt);
+        layer->invalidateAll();
+    }
+
+    /* put it all on the screen! (skipped when nothing moved) */
+    if (layer->draw(draw_background, draw_foreground))
+        input->presented();
+    else
+        input->skipped();
+    report_stats(now_ns);
 
     return SDL_APP_CONTINUE; /* carry on with the program! */
 }
@@ -155,6 +348,16 @@ SDL_AppIterate(void* appstate)
 void
 SDL_AppQuit(void* appstate, SDL_AppResult result)
 {
-    SDL_DestroyTexture(texture);
+    if (layer) {
+        SDL_Log("retained: presented %llu frames, skipped %llu, %.1f%% of "
+                "presented pixels recomposed",
+                (unsigned long long)layer->getFramesPresented(),
+                (unsigned long long)layer->getFramesSkipped(),
+                layer->getComposedRatio() * 100.0f);
+        delete layer;
+    }
+    delete input;
+    delete batch;
+    delete atlas; /* destroys the page textures */
     /* SDL will clean up the window/renderer for us. */
 }
\ No newline at end of file
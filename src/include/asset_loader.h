@@ -0,0 +1,317 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <SDL3_image/SDL_image.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Background asset loading. Worker threads read and decode files (images to
+// surfaces, fonts to TTF_Font) and hand them to a ready queue; the render
+// thread drains that queue in update() for at most a time budget per frame,
+// creating the textures, so a large asset set never stalls a frame for more
+// than roughly one upload. Progress counts bytes of finished assets (failed
+// ones included), falling back to the asset count when sizes are unknown.
+//
+// Assets are referred to by the id returned from addImage()/addFont(). A
+// font can also come from memory the caller keeps alive (e.g. an embedded
+// array); it still decodes on a worker.
+// Everything except the constructor's workers runs on the render thread.
+class AssetLoader
+{
+  public:
+    enum Kind
+    {
+        Image,
+        Font
+    };
+
+    enum State
+    {
+        Queued,
+        Decoded, // waiting in the ready queue
+        Done,
+        Failed
+    };
+
+  private:
+    struct Asset
+    {
+        std::string path;
+        Kind kind;
+        float ptsize = 0.0f;
+        Uint64 estimate = 0; // file size when queued
+        Uint64 bytes = 0;    // bytes actually read
+        const void* memory = nullptr; // caller's bytes instead of the file
+        size_t memorySize = 0;
+        std::atomic<State> state{ Queued }; // set by a worker when decoded
+
+        void* data = nullptr; // file contents, a font reads from it lazily
+        SDL_Surface* surface = nullptr;
+        SDL_Texture* texture = nullptr;
+        TTF_Font* font = nullptr;
+    };
+
+    std::deque<Asset> assets; // deque: workers keep pointers while we add
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<Asset*> jobs;
+    std::deque<Asset*> ready;
+    bool stopping = false;
+
+    // FreeType không an toàn khi mở nhiều font song song
+    std::mutex fontMutex;
+
+    std::atomic<Uint64> bytesDecoded{ 0 };
+    Uint64 bytesTotal = 0, bytesDone = 0;
+    int assetsDone = 0, assetsFailed = 0;
+    Uint64 textureBytes = 0;
+
+    Uint64 startTime = 0, finishTime = 0;
+    Uint64 maxUpdate = 0; // longest update() so far, ns
+
+    void decode(Asset& asset)
+    {
+        const void* bytes = asset.memory;
+        size_t size = asset.memorySize;
+        if (!bytes) {
+            asset.data = SDL_LoadFile(asset.path.c_str(), &size);
+            if (!asset.data) {
+                SDL_Log("%s: %s", asset.path.c_str(), SDL_GetError());
+                asset.state = Failed;
+                return;
+            }
+            bytes = asset.data;
+        }
+        asset.bytes = size;
+
+        SDL_IOStream* io = SDL_IOFromConstMem(bytes, size);
+        if (asset.kind == Image) {
+            asset.surface = IMG_Load_IO(io, true);
+            SDL_free(asset.data);
+            asset.data = nullptr;
+        } else {
+            std::lock_guard<std::mutex> lock(fontMutex);
+            asset.font = TTF_OpenFontIO(io, true, asset.ptsize);
+        }
+
+        if (!asset.surface && !asset.font) {
+            SDL_Log("%s: %s", asset.path.c_str(), SDL_GetError());
+            SDL_free(asset.data);
+            asset.data = nullptr;
+            asset.state = Failed;
+            return;
+        }
+        asset.state = Decoded;
+    }
+
+    void workerLoop()
+    {
+        for (;;) {
+            Asset* asset;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&] { return stopping || !jobs.empty(); });
+                if (stopping)
+                    return;
+                asset = jobs.front();
+                jobs.pop_front();
+            }
+
+            decode(*asset);
+            bytesDecoded += asset->bytes;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            ready.push_back(asset);
+        }
+    }
+
+    int add(const char* path,
+            Kind kind,
+            float ptsize,
+            const void* memory = nullptr,
+            size_t memorySize = 0)
+    {
+        Asset& asset = assets.emplace_back();
+        asset.path = path;
+        asset.kind = kind;
+        asset.ptsize = ptsize;
+        asset.memory = memory;
+        asset.memorySize = memorySize;
+
+        // Kích thước ước lượng để vẽ thanh tiến độ trước khi đọc file
+        SDL_PathInfo info;
+        if (memory)
+            asset.estimate = memorySize;
+        else if (SDL_GetPathInfo(path, &info))
+            asset.estimate = info.size;
+        bytesTotal += asset.estimate;
+
+        if (startTime == 0 || finishTime != 0) {
+            startTime = SDL_GetTicksNS();
+            finishTime = 0;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobs.push_back(&asset);
+        }
+        wake.notify_one();
+        return (int)assets.size() - 1;
+    }
+
+    // Swap the estimate for the real size in the totals
+    void finish(Asset& asset)
+    {
+        bytesTotal = bytesTotal - asset.estimate + asset.bytes;
+        bytesDone += asset.bytes;
+        if (asset.state == Failed)
+            assetsFailed++;
+        assetsDone++;
+    }
+
+  public:
+    // `threads` decoding threads; 0 means one per logical core but one, which
+    // is left to the render thread
+    explicit AssetLoader(int threads = 0)
+    {
+        if (threads <= 0)
+            threads = std::max(1, SDL_GetNumLogicalCPUCores() - 1);
+        for (int i = 0; i < threads; i++)
+            workers.emplace_back(&AssetLoader::workerLoop, this);
+    }
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    // Fonts are closed here, so destroy the loader before TTF_Quit()
+    ~AssetLoader()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& worker : workers)
+            worker.join();
+
+        for (Asset& asset : assets) {
+            SDL_DestroySurface(asset.surface);
+            SDL_DestroyTexture(asset.texture);
+            if (asset.font)
+                TTF_CloseFont(asset.font);
+            SDL_free(asset.data);
+        }
+    }
+
+    int addImage(const char* path) { return add(path, Image, 0.0f); }
+    int addFont(const char* path, float ptsize)
+    {
+        return add(path, Font, ptsize);
+    }
+    // `name` is only for logs and getPath(); `data` must outlive the loader
+    int addFont(const char* name, const void* data, size_t size, float ptsize)
+    {
+        return add(name, Font, ptsize, data, size);
+    }
+
+    // Turn decoded assets into textures until `budget` ns have passed (at
+    // least one per call so loading always moves forward). Returns how many
+    // assets were finished.
+    int update(SDL_Renderer* renderer, Uint64 budget)
+    {
+        Uint64 start = SDL_GetTicksNS();
+        int finished = 0;
+        for (;;) {
+            Asset* asset;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (ready.empty())
+                    break;
+                asset = ready.front();
+                ready.pop_front();
+            }
+
+            if (asset->state == Decoded && asset->kind == Image) {
+                asset->texture =
+                  SDL_CreateTextureFromSurface(renderer, asset->surface);
+                if (asset->texture) {
+                    textureBytes +=
+                      (Uint64)asset->surface->w * asset->surface->h * 4;
+                } else {
+                    SDL_Log("%s: %s", asset->path.c_str(), SDL_GetError());
+                    asset->state = Failed;
+                }
+                SDL_DestroySurface(asset->surface);
+                asset->surface = nullptr;
+            }
+            if (asset->state == Decoded)
+                asset->state = Done;
+            finish(*asset);
+            finished++;
+
+            if (SDL_GetTicksNS() - start >= budget)
+                break;
+        }
+
+        if (finished > 0 && isDone())
+            finishTime = SDL_GetTicksNS();
+        maxUpdate = std::max(maxUpdate, SDL_GetTicksNS() - start);
+        return finished;
+    }
+
+    bool isDone() const { return assetsDone == (int)assets.size(); }
+
+    // 0..1, by bytes of finished assets
+    float getProgress() const
+    {
+        if (assets.empty())
+            return 1.0f;
+        if (bytesTotal == 0)
+            return assetsDone / (float)assets.size();
+        return std::min(1.0f, bytesDone / (float)bytesTotal);
+    }
+
+    // 0..1, by bytes read and decoded on the workers
+    float getDecodeProgress() const
+    {
+        if (bytesTotal == 0)
+            return isDone() ? 1.0f : 0.0f;
+        return std::min(1.0f, bytesDecoded / (float)bytesTotal);
+    }
+
+    int getAssetCount() const { return (int)assets.size(); }
+    int getDoneCount() const { return assetsDone; }
+    int getFailedCount() const { return assetsFailed; }
+    Uint64 getBytesTotal() const { return bytesTotal; }
+    Uint64 getBytesDone() const { return bytesDone; }
+    Uint64 getTextureBytes() const { return textureBytes; }
+    Uint64 getMaxUpdateTime() const { return maxUpdate; }
+
+    // Time from the first add() until everything was finished (or until now)
+    Uint64 getElapsed() const
+    {
+        if (startTime == 0)
+            return 0;
+        return (finishTime ? finishTime : SDL_GetTicksNS()) - startTime;
+    }
+
+    State getState(int id) const { return assets[id].state; }
+    const char* getPath(int id) const { return assets[id].path.c_str(); }
+
+    // Null until the asset is Done
+    SDL_Texture* getTexture(int id) const
+    {
+        return assets[id].state == Done ? assets[id].texture : nullptr;
+    }
+    TTF_Font* getFont(int id) const
+    {
+        return assets[id].state == Done ? assets[id].font : nullptr;
+    }
+};
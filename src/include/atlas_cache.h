@@ -0,0 +1,137 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// One packed image: the atlas page texture and where the image sits in it
+struct AtlasSprite
+{
+    SDL_Texture* texture;
+    SDL_FRect src;
+};
+
+// Runtime side of atlaspack: reads the manifest written at build time,
+// decodes and uploads every page once and hands out sprites by image name
+// (file name without extension). Sprite pointers stay valid until clear().
+//
+// Manifest (atlas.txt), one entry per line:
+//   page INDEX FILE
+//   sprite NAME PAGE X Y W H
+class AtlasCache
+{
+  private:
+    std::vector<SDL_Texture*> pages;
+    std::vector<AtlasSprite> sprites;
+    std::unordered_map<std::string, size_t> names;
+
+  public:
+    AtlasCache() = default;
+    AtlasCache(const AtlasCache&) = delete;
+    AtlasCache& operator=(const AtlasCache&) = delete;
+    ~AtlasCache() { clear(); }
+
+    // Load `dir`/atlas.txt and its pages; `dir` ends with a path separator.
+    // Does nothing when already loaded. On failure SDL_GetError() says why.
+    bool load(SDL_Renderer* renderer, const char* dir)
+    {
+        if (!pages.empty())
+            return true;
+
+        std::string base = dir;
+        size_t size = 0;
+        char* text = (char*)SDL_LoadFile((base + "atlas.txt").c_str(), &size);
+        if (!text)
+            return false;
+
+        struct Entry
+        {
+            int page;
+            SDL_FRect src;
+        };
+        std::vector<Entry> entries;
+        std::vector<std::string> entryNames;
+        bool ok = true;
+
+        for (char* line = text; ok && line < text + size;) {
+            char* end = SDL_strchr(line, '\n');
+            if (end)
+                *end = '\0';
+
+            char name[256];
+            int index, x, y, w, h;
+            if (SDL_sscanf(line, "page %d %255s", &index, name) == 2) {
+                if (index != (int)pages.size()) {
+                    ok = SDL_SetError("atlas page %d out of order", index);
+                    break;
+                }
+                SDL_Surface* surface = SDL_LoadBMP((base + name).c_str());
+                if (!surface) {
+                    ok = false;
+                    break;
+                }
+                SDL_Texture* texture =
+                  SDL_CreateTextureFromSurface(renderer, surface);
+                SDL_DestroySurface(surface);
+                if (!texture) {
+                    ok = false;
+                    break;
+                }
+                pages.push_back(texture);
+            } else if (SDL_sscanf(line,
+                                  "sprite %255s %d %d %d %d %d",
+                                  name,
+                                  &index,
+                                  &x,
+                                  &y,
+                                  &w,
+                                  &h) == 6) {
+                entries.push_back(
+                  { index, { (float)x, (float)y, (float)w, (float)h } });
+                entryNames.push_back(name);
+            }
+
+            if (!end)
+                break;
+            line = end + 1;
+        }
+        SDL_free(text);
+
+        // Sprite có thể đứng trước page trong manifest, gắn texture sau cùng
+        for (size_t i = 0; ok && i < entries.size(); i++) {
+            if (entries[i].page < 0 || entries[i].page >= (int)pages.size()) {
+                ok = SDL_SetError("atlas sprite %s has no page %d",
+                                  entryNames[i].c_str(),
+                                  entries[i].page);
+                break;
+            }
+            names[entryNames[i]] = sprites.size();
+            sprites.push_back({ pages[entries[i].page], entries[i].src });
+        }
+
+        if (ok && pages.empty())
+            ok = SDL_SetError("atlas manifest in %s has no pages", dir);
+        if (!ok)
+            clear();
+        return ok;
+    }
+
+    // Sprite packed from images/`name`.*, null when there is none
+    const AtlasSprite* get(const char* name) const
+    {
+        auto it = names.find(name);
+        return it == names.end() ? nullptr : &sprites[it->second];
+    }
+
+    size_t getSpriteCount() const { return sprites.size(); }
+    size_t getPageCount() const { return pages.size(); }
+
+    void clear()
+    {
+        for (SDL_Texture* texture : pages)
+            SDL_DestroyTexture(texture);
+        pages.clear();
+        sprites.clear();
+        names.clear();
+    }
+};
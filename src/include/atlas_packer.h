@@ -0,0 +1,102 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <vector>
+
+// Skyline bottom-left rectangle packer. The packed area is described by its
+// top outline, a list of horizontal segments; every rectangle goes where its
+// top edge ends up lowest (leftmost on ties) and raises the outline under it.
+// Space left below an overhang is never reused, which wastes a little compared
+// to MaxRects but keeps insert() linear in the number of segments.
+class SkylinePacker
+{
+  private:
+    struct Segment
+    {
+        int x, y, width;
+    };
+
+    int width = 0, height = 0;
+    int usedWidth = 0, usedHeight = 0;
+    std::vector<Segment> skyline;
+
+    // Lowest y where a w x h rectangle starting at segment i fits, -1 if none
+    int fit(size_t i, int w, int h) const
+    {
+        if (skyline[i].x + w > width)
+            return -1;
+        int y = 0;
+        for (int left = w; left > 0; i++) {
+            y = SDL_max(y, skyline[i].y);
+            if (y + h > height)
+                return -1;
+            left -= skyline[i].width;
+        }
+        return y;
+    }
+
+  public:
+    SkylinePacker(int w, int h) { reset(w, h); }
+
+    void reset(int w, int h)
+    {
+        width = w;
+        height = h;
+        usedWidth = usedHeight = 0;
+        skyline.assign(1, Segment{ 0, 0, w });
+    }
+
+    bool insert(int w, int h, SDL_Rect& rect)
+    {
+        if (w <= 0 || h <= 0)
+            return false;
+
+        int bestIndex = -1, bestTop = 0, bestX = 0;
+        for (size_t i = 0; i < skyline.size(); i++) {
+            int y = fit(i, w, h);
+            if (y < 0)
+                continue;
+            if (bestIndex < 0 || y + h < bestTop ||
+                (y + h == bestTop && skyline[i].x < bestX)) {
+                bestIndex = (int)i;
+                bestTop = y + h;
+                bestX = skyline[i].x;
+            }
+        }
+        if (bestIndex < 0)
+            return false;
+
+        rect = { bestX, bestTop - h, w, h };
+        skyline.insert(skyline.begin() + bestIndex,
+                       Segment{ bestX, bestTop, w });
+
+        // Cắt các đoạn bị hình mới che
+        for (size_t i = bestIndex + 1; i < skyline.size();) {
+            int covered = bestX + w - skyline[i].x;
+            if (covered <= 0)
+                break;
+            skyline[i].x += covered;
+            skyline[i].width -= covered;
+            if (skyline[i].width > 0)
+                break;
+            skyline.erase(skyline.begin() + i);
+        }
+
+        // Gộp các đoạn liền kề cùng độ cao
+        for (size_t i = 1; i < skyline.size();) {
+            if (skyline[i - 1].y == skyline[i].y) {
+                skyline[i - 1].width += skyline[i].width;
+                skyline.erase(skyline.begin() + i);
+            } else {
+                i++;
+            }
+        }
+
+        usedWidth = SDL_max(usedWidth, bestX + w);
+        usedHeight = SDL_max(usedHeight, bestTop);
+        return true;
+    }
+
+    // Bounding box of everything inserted since the last reset()
+    int getUsedWidth() const { return usedWidth; }
+    int getUsedHeight() const { return usedHeight; }
+};
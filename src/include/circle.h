@@ -1,4 +1,7 @@
 #include <SDL3/SDL.h>
+#include "circle_atlas.h"
+#include <cmath>
+#include <vector>
 
 class Circle
 {
@@ -6,6 +9,19 @@ class Circle
     int centerX, centerY, radius;
     bool filled;
 
+    // Scratch buffers reused across draws so a frame does not reallocate
+    std::vector<SDL_FPoint> points;
+    std::vector<SDL_FRect> spans;
+    std::vector<int> halfWidths;
+
+    void pushSpan(int centerX, int y, int halfWidth)
+    {
+        spans.push_back({ (float)(centerX - halfWidth),
+                          (float)y,
+                          (float)(2 * halfWidth + 1),
+                          1.0f });
+    }
+
   public:
     Circle(int x, int y, int r, bool fill = false)
       : centerX(x)
@@ -24,6 +40,20 @@ class Circle
         }
     }
 
+    // Vẽ bằng atlas: một lần blit thay vì rasterize lại mỗi frame. Dùng màu
+    // vẽ hiện tại của renderer giống như các hàm bên dưới
+    void draw(SDL_Renderer* renderer, CircleAtlas& atlas)
+    {
+        SDL_Color color;
+        SDL_GetRenderDrawColor(
+          renderer, &color.r, &color.g, &color.b, &color.a);
+
+        bool drawn = filled ? atlas.drawDisc(centerX, centerY, radius, color)
+                            : atlas.drawRing(centerX, centerY, radius, color);
+        if (!drawn)
+            draw(renderer);
+    }
+
     bool isPointInside(int x, int y)
     {
         int dx = x - centerX;
@@ -41,16 +71,17 @@ class Circle
         int y = radius;
         int d = 3 - 2 * radius;
 
+        points.clear();
         while (x <= y) {
             // Vẽ 8 điểm đối xứng
-            SDL_RenderPoint(renderer, centerX + x, centerY + y);
-            SDL_RenderPoint(renderer, centerX - x, centerY + y);
-            SDL_RenderPoint(renderer, centerX + x, centerY - y);
-            SDL_RenderPoint(renderer, centerX - x, centerY - y);
-            SDL_RenderPoint(renderer, centerX + y, centerY + x);
-            SDL_RenderPoint(renderer, centerX - y, centerY + x);
-            SDL_RenderPoint(renderer, centerX + y, centerY - x);
-            SDL_RenderPoint(renderer, centerX - y, centerY - x);
+            points.push_back({ (float)(centerX + x), (float)(centerY + y) });
+            points.push_back({ (float)(centerX - x), (float)(centerY + y) });
+            points.push_back({ (float)(centerX + x), (float)(centerY - y) });
+            points.push_back({ (float)(centerX - x), (float)(centerY - y) });
+            points.push_back({ (float)(centerX + y), (float)(centerY + x) });
+            points.push_back({ (float)(centerX - y), (float)(centerY + x) });
+            points.push_back({ (float)(centerX + y), (float)(centerY - x) });
+            points.push_back({ (float)(centerX - y), (float)(centerY - x) });
 
             if (d < 0) {
                 d = d + 4 * x + 6;
@@ -60,43 +91,49 @@ class Circle
             }
             x++;
         }
+
+        // Cả 8 octant đi trong một lần gọi
+        SDL_RenderPoints(renderer, points.data(), (int)points.size());
     }
 
-    // Vẽ hình tròn đặc (filled circle)
+    // Vẽ hình tròn đặc (filled circle): mỗi hàng là một span, tính trực tiếp
+    // từ x * x + y * y <= r * r
     void fillCircle(SDL_Renderer* renderer,
                     int centerX,
                     int centerY,
                     int radius)
     {
+        spans.clear();
         for (int y = -radius; y <= radius; y++) {
-            for (int x = -radius; x <= radius; x++) {
-                if (x * x + y * y <= radius * radius) {
-                    SDL_RenderPoint(renderer, centerX + x, centerY + y);
-                }
-            }
+            int halfWidth = (int)std::sqrt((float)(radius * radius - y * y));
+            pushSpan(centerX, centerY + y, halfWidth);
         }
+        SDL_RenderFillRects(renderer, spans.data(), (int)spans.size());
     }
 
-    // Cách tối ưu hơn cho filled circle
+    // Cách tối ưu hơn cho filled circle: thuật toán midpoint chỉ ghi lại độ
+    // rộng lớn nhất của mỗi hàng, sau đó mỗi hàng được phát đúng một lần (không
+    // overdraw) và cả hình tròn đi trong một lần SDL_RenderFillRects
     void fillCircleOptimized(SDL_Renderer* renderer,
                              int centerX,
                              int centerY,
                              int radius)
     {
+        if (radius < 0)
+            return;
+
+        halfWidths.assign(radius + 1, 0);
+
         int x = 0;
         int y = radius;
         int d = 3 - 2 * radius;
 
         while (x <= y) {
-            // Vẽ đường ngang
-            for (int i = centerX - x; i <= centerX + x; i++) {
-                SDL_RenderPoint(renderer, i, centerY + y);
-                SDL_RenderPoint(renderer, i, centerY - y);
-            }
-            for (int i = centerX - y; i <= centerX + y; i++) {
-                SDL_RenderPoint(renderer, i, centerY + x);
-                SDL_RenderPoint(renderer, i, centerY - x);
-            }
+            // Hàng ±y rộng x, hàng ±x rộng y
+            if (halfWidths[y] < x)
+                halfWidths[y] = x;
+            if (halfWidths[x] < y)
+                halfWidths[x] = y;
 
             if (d < 0) {
                 d = d + 4 * x + 6;
@@ -106,5 +143,13 @@ class Circle
             }
             x++;
         }
+
+        spans.clear();
+        pushSpan(centerX, centerY, halfWidths[0]);
+        for (int row = 1; row <= radius; row++) {
+            pushSpan(centerX, centerY - row, halfWidths[row]);
+            pushSpan(centerX, centerY + row, halfWidths[row]);
+        }
+        SDL_RenderFillRects(renderer, spans.data(), (int)spans.size());
     }
 };
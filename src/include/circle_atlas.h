@@ -0,0 +1,167 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <cmath>
+#include <vector>
+
+// Pre-rendered discs and rings packed into one atlas texture. Each radius is
+// rasterized once on first use (optionally anti-aliased) and afterwards drawn
+// as a single SDL_RenderTexture with color/alpha modulation.
+class CircleAtlas
+{
+  private:
+    struct Slot
+    {
+        SDL_FRect src;
+        bool ready = false;
+    };
+
+    SDL_Renderer* renderer;
+    SDL_Texture* texture = nullptr;
+    int size, maxRadius, ringWidth;
+    bool antiAliased;
+
+    std::vector<Slot> discs;
+    std::vector<Slot> rings;
+    std::vector<Uint32> pixels;
+
+    // Shelf packing: slots fill a row left to right, a new shelf starts when
+    // the row is full
+    int cursorX = 0, cursorY = 0, shelfHeight = 0;
+
+    float coverage(float distance, float edge) const
+    {
+        if (!antiAliased)
+            return distance <= edge ? 1.0f : 0.0f;
+        return SDL_clamp(edge + 0.5f - distance, 0.0f, 1.0f);
+    }
+
+    bool allocate(int side, SDL_Rect& rect)
+    {
+        if (cursorX + side > size) {
+            cursorX = 0;
+            cursorY += shelfHeight;
+            shelfHeight = 0;
+        }
+        if (side > size || cursorY + side > size)
+            return false;
+
+        rect = { cursorX, cursorY, side, side };
+        cursorX += side;
+        if (shelfHeight < side)
+            shelfHeight = side;
+        return true;
+    }
+
+    const Slot* bake(std::vector<Slot>& slots, int radius, bool ring)
+    {
+        if (!texture || radius < 1 || radius > maxRadius)
+            return nullptr;
+        Slot& slot = slots[radius];
+        if (slot.ready)
+            return &slot;
+
+        // One pixel of padding around the disc keeps linear filtering from
+        // bleeding neighbours into the edge
+        int side = 2 * radius + 3;
+        SDL_Rect rect;
+        if (!allocate(side, rect))
+            return nullptr;
+
+        pixels.assign(side * side, 0);
+        float c = (side - 1) / 2.0f;
+        for (int py = 0; py < side; py++) {
+            for (int px = 0; px < side; px++) {
+                float dx = px - c, dy = py - c;
+                float distance = std::sqrt(dx * dx + dy * dy);
+                float alpha = coverage(distance, (float)radius);
+                if (ring)
+                    alpha *=
+                      1.0f - coverage(distance, (float)(radius - ringWidth));
+                // RGBA32 là byte order R, G, B, A trên mọi platform
+                Uint8 a = (Uint8)(alpha * 255.0f + 0.5f);
+                Uint8* p = (Uint8*)&pixels[py * side + px];
+                p[0] = p[1] = p[2] = 255;
+                p[3] = a;
+            }
+        }
+        SDL_UpdateTexture(texture, &rect, pixels.data(), side * 4);
+
+        slot.src = { (float)rect.x, (float)rect.y, (float)side, (float)side };
+        slot.ready = true;
+        return &slot;
+    }
+
+    bool blit(const Slot* slot, float x, float y, SDL_Color color)
+    {
+        if (!slot)
+            return false;
+
+        float half = slot->src.w / 2.0f;
+        SDL_FRect dst = { x - half, y - half, slot->src.w, slot->src.h };
+        SDL_SetTextureColorMod(texture, color.r, color.g, color.b);
+        SDL_SetTextureAlphaMod(texture, color.a);
+        return SDL_RenderTexture(renderer, texture, &slot->src, &dst);
+    }
+
+  public:
+    CircleAtlas(SDL_Renderer* renderer,
+                int maxRadius = 64,
+                bool antiAliased = true,
+                int ringWidth = 1,
+                int size = 1024)
+      : renderer(renderer)
+      , size(size)
+      , maxRadius(maxRadius)
+      , ringWidth(ringWidth)
+      , antiAliased(antiAliased)
+      , discs(maxRadius + 1)
+      , rings(maxRadius + 1)
+    {
+        texture = SDL_CreateTexture(renderer,
+                                    SDL_PIXELFORMAT_RGBA32,
+                                    SDL_TEXTUREACCESS_STATIC,
+                                    size,
+                                    size);
+        if (!texture) {
+            SDL_Log("Couldn't create circle atlas: %s", SDL_GetError());
+            return;
+        }
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+        // Start fully transparent so unused regions never show up
+        pixels.assign(size * size, 0);
+        SDL_UpdateTexture(texture, nullptr, pixels.data(), size * 4);
+    }
+
+    CircleAtlas(const CircleAtlas&) = delete;
+    CircleAtlas& operator=(const CircleAtlas&) = delete;
+
+    ~CircleAtlas()
+    {
+        if (texture)
+            SDL_DestroyTexture(texture);
+    }
+
+    // Return false when the radius does not fit the atlas so the caller can
+    // fall back to rasterizing it directly
+    bool drawDisc(float x, float y, int radius, SDL_Color color)
+    {
+        return blit(bake(discs, radius, false), x, y, color);
+    }
+
+    bool drawRing(float x, float y, int radius, SDL_Color color)
+    {
+        return blit(bake(rings, radius, true), x, y, color);
+    }
+
+    // Atlas rect của đĩa (bake nếu chưa có), dùng khi caller tự gom quad vào
+    // một lần SDL_RenderGeometry. nullptr nếu bán kính không vừa atlas
+    const SDL_FRect* discRect(int radius)
+    {
+        const Slot* slot = bake(discs, radius, false);
+        return slot ? &slot->src : nullptr;
+    }
+
+    SDL_Texture* getTexture() const { return texture; }
+    int getSize() const { return size; }
+};
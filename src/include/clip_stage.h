@@ -0,0 +1,267 @@
+#pragma once
+#include "soft_raster.h"
+#include <glm/glm.hpp>
+#include <vector>
+
+// Vertex in clip space, straight out of the MVP transform
+struct ClipVertex
+{
+    glm::vec4 position;
+    glm::vec3 color;
+};
+
+// Per-frame counters of the clip stage
+struct ClipStats
+{
+    int input = 0;          // triangles submitted
+    int culledBackface = 0; // facing away from the camera
+    int culledOutside = 0;  // entirely outside one frustum plane
+    int clipped = 0;        // crossed the near plane or the guard band
+    int output = 0;         // triangles emitted, after clipping
+};
+
+// Culling and clipping between vertex transform and triangle sorting.
+// Every vertex gets an outcode once; triangles entirely outside one frustum
+// plane are rejected, triangles crossing the near plane or the guard band are
+// clipped with Sutherland-Hodgman in homogeneous clip space and
+// re-triangulated as a fan, and the remaining ones are rejected when they
+// wind clockwise in clip space (counter-clockwise on the y-down screen).
+//
+// Output is a screen-space vertex array -- the projected input vertices
+// followed by any vertices created by clipping -- and an index triple per
+// emitted triangle. When the transform stage already projected every input
+// vertex (see transform_kernel.h) it passes `projected` and the first
+// vertices.size() entries of outVertices are used as they are.
+class ClipStage
+{
+  public:
+    // Clipping only kicks in beyond guardBand times the viewport, so large
+    // triangles that merely overhang the screen are left to the rasterizer's
+    // bounding box clamp
+    static constexpr float guardBand = 4.0f;
+
+    bool cullBackfaces = true;
+
+  private:
+    enum : Uint16
+    {
+        Near = 1 << 0,
+        GuardLeft = 1 << 1,
+        GuardRight = 1 << 2,
+        GuardBottom = 1 << 3,
+        GuardTop = 1 << 4,
+        ClipMask = Near | GuardLeft | GuardRight | GuardBottom | GuardTop,
+
+        Left = 1 << 5,
+        Right = 1 << 6,
+        Bottom = 1 << 7,
+        Top = 1 << 8,
+        Far = 1 << 9,
+    };
+
+    static constexpr int clipPlanes = 5;
+    static constexpr int maxPolygon = 3 + clipPlanes;
+
+    struct PolyVertex
+    {
+        ClipVertex v;
+        Sint64 source; // index in the input array, -1 when made by clipping
+    };
+
+    std::vector<Uint16> codes;
+
+    static Uint16 Outcode(const glm::vec4& p)
+    {
+        float g = guardBand * p.w;
+        Uint16 code = 0;
+        if (p.z < -p.w)
+            code |= Near;
+        if (p.x < -g)
+            code |= GuardLeft;
+        if (p.x > g)
+            code |= GuardRight;
+        if (p.y < -g)
+            code |= GuardBottom;
+        if (p.y > g)
+            code |= GuardTop;
+        if (p.x < -p.w)
+            code |= Left;
+        if (p.x > p.w)
+            code |= Right;
+        if (p.y < -p.w)
+            code |= Bottom;
+        if (p.y > p.w)
+            code |= Top;
+        if (p.z > p.w)
+            code |= Far;
+        return code;
+    }
+
+    // Signed distance to clip plane `plane`; inside when >= 0
+    static float Distance(const glm::vec4& p, int plane)
+    {
+        float g = guardBand * p.w;
+        switch (plane) {
+            case 0:
+                return p.z + p.w;
+            case 1:
+                return p.x + g;
+            case 2:
+                return g - p.x;
+            case 3:
+                return p.y + g;
+            default:
+                return g - p.y;
+        }
+    }
+
+    static int ClipPolygon(PolyVertex* in,
+                           int count,
+                           PolyVertex* out,
+                           int plane)
+    {
+        int n = 0;
+        for (int i = 0; i < count; i++) {
+            const PolyVertex& a = in[i];
+            const PolyVertex& b = in[(i + 1) % count];
+            float da = Distance(a.v.position, plane);
+            float db = Distance(b.v.position, plane);
+
+            if (da >= 0.0f)
+                out[n++] = a;
+            if ((da >= 0.0f) != (db >= 0.0f)) {
+                // Clip-space attributes are linear along the edge
+                float t = da / (da - db);
+                PolyVertex& p = out[n++];
+                p.v.position =
+                  a.v.position + (b.v.position - a.v.position) * t;
+                p.v.color = a.v.color + (b.v.color - a.v.color) * t;
+                p.source = -1;
+            }
+        }
+        return n;
+    }
+
+    // Twice the signed screen-space area; negative for front faces
+    static float ScreenArea(const RasterVertex& a,
+                            const RasterVertex& b,
+                            const RasterVertex& c)
+    {
+        return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    }
+
+  public:
+    static RasterVertex Project(const ClipVertex& vertex,
+                                int width,
+                                int height)
+    {
+        const glm::vec4& p = vertex.position;
+        float invW = 1.0f / p.w;
+
+        RasterVertex out;
+        out.x = (p.x * invW + 1.0f) * 0.5f * width;
+        out.y = (1.0f - p.y * invW) * 0.5f * height;
+        out.z = p.z * invW;
+        out.invW = invW;
+        out.color = vertex.color;
+        return out;
+    }
+
+    void Process(const std::vector<ClipVertex>& vertices,
+                 const Uint32* indices,
+                 size_t indexCount,
+                 int width,
+                 int height,
+                 std::vector<RasterVertex>& outVertices,
+                 std::vector<Uint32>& outIndices,
+                 ClipStats& stats,
+                 bool projected = false)
+    {
+        stats = ClipStats();
+        outIndices.clear();
+        outVertices.resize(vertices.size());
+        codes.resize(vertices.size());
+
+        // Mỗi đỉnh chỉ tính outcode và chiếu một lần
+        for (size_t i = 0; i < vertices.size(); i++) {
+            codes[i] = Outcode(vertices[i].position);
+            if (!projected && !(codes[i] & Near))
+                outVertices[i] = Project(vertices[i], width, height);
+        }
+
+        for (size_t t = 0; t + 2 < indexCount; t += 3) {
+            Uint32 i0 = indices[t], i1 = indices[t + 1], i2 = indices[t + 2];
+            stats.input++;
+
+            if (codes[i0] & codes[i1] & codes[i2]) {
+                stats.culledOutside++;
+                continue;
+            }
+
+            Uint16 crossing = (codes[i0] | codes[i1] | codes[i2]) & ClipMask;
+            if (!crossing) {
+                if (cullBackfaces &&
+                    ScreenArea(outVertices[i0],
+                               outVertices[i1],
+                               outVertices[i2]) >= 0.0f) {
+                    stats.culledBackface++;
+                    continue;
+                }
+                outIndices.insert(outIndices.end(), { i0, i1, i2 });
+                stats.output++;
+                continue;
+            }
+
+            // Sutherland-Hodgman against only the planes this triangle
+            // actually crosses
+            PolyVertex bufferA[maxPolygon], bufferB[maxPolygon];
+            PolyVertex* poly = bufferA;
+            PolyVertex* next = bufferB;
+            poly[0] = { vertices[i0], i0 };
+            poly[1] = { vertices[i1], i1 };
+            poly[2] = { vertices[i2], i2 };
+            int count = 3;
+            for (int plane = 0; plane < clipPlanes && count >= 3; plane++) {
+                if (crossing & (1 << plane)) {
+                    count = ClipPolygon(poly, count, next, plane);
+                    std::swap(poly, next);
+                }
+            }
+            stats.clipped++;
+            if (count < 3)
+                continue;
+
+            // Project the polygon, reusing cache entries for original corners
+            Uint32 polyIndex[maxPolygon];
+            for (int k = 0; k < count; k++) {
+                if (poly[k].source >= 0) {
+                    polyIndex[k] = (Uint32)poly[k].source;
+                } else {
+                    polyIndex[k] = (Uint32)outVertices.size();
+                    outVertices.push_back(Project(poly[k].v, width, height));
+                }
+            }
+
+            // Shoelace over the whole polygon so slivers still cull reliably
+            if (cullBackfaces) {
+                float area = 0.0f;
+                for (int k = 1; k + 1 < count; k++)
+                    area += ScreenArea(outVertices[polyIndex[0]],
+                                       outVertices[polyIndex[k]],
+                                       outVertices[polyIndex[k + 1]]);
+                if (area >= 0.0f) {
+                    stats.culledBackface++;
+                    continue;
+                }
+            }
+
+            for (int k = 1; k + 1 < count; k++) {
+                outIndices.insert(outIndices.end(),
+                                  { polyIndex[0],
+                                    polyIndex[k],
+                                    polyIndex[k + 1] });
+                stats.output++;
+            }
+        }
+    }
+};
@@ -0,0 +1,143 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <cstring>
+#include <vector>
+
+// Per-frame depth ordering for triangle lists. Depths become order-preserving
+// 32-bit integer keys packed with the triangle index, and are sorted with an
+// LSD radix sort (three 11-bit digits, one histogram pass, digits shared by
+// every key skipped). Buffers persist between frames.
+//
+// Between frames the order usually barely changes, so when the count matches
+// the last call the previous order is replayed first and fixed up with an
+// insertion sort; if that needs more than one move per four elements it is
+// abandoned and the radix sort finishes the job. After a failed attempt the
+// replay is skipped for 1, 2, 4, ... 32 frames so scenes that reshuffle every
+// frame don't pay for it twice.
+class DepthSorter
+{
+  private:
+    struct Entry
+    {
+        Uint32 key;
+        Uint32 index;
+    };
+
+    static constexpr int digitBits = 11;
+    static constexpr int buckets = 1 << digitBits;
+    static constexpr int passes = 3;
+
+    std::vector<Entry> entries, scratch;
+    std::vector<Uint32> order;
+    Uint32 histogram[passes][buckets];
+
+    int radixFrames = 0, coherentFrames = 0;
+    int backoff = 0, skipFrames = 0;
+
+    // Try to finish a nearly sorted array within `budget` element moves
+    bool InsertionSort(size_t budget)
+    {
+        size_t moves = 0;
+        for (size_t i = 1; i < entries.size(); i++) {
+            Entry e = entries[i];
+            size_t j = i;
+            while (j > 0 && entries[j - 1].key > e.key) {
+                entries[j] = entries[j - 1];
+                j--;
+                if (++moves > budget) {
+                    entries[j] = e;
+                    return false;
+                }
+            }
+            entries[j] = e;
+        }
+        return true;
+    }
+
+    void RadixSort()
+    {
+        size_t count = entries.size();
+        memset(histogram, 0, sizeof(histogram));
+        for (const Entry& e : entries)
+            for (int p = 0; p < passes; p++)
+                histogram[p][(e.key >> (p * digitBits)) & (buckets - 1)]++;
+
+        scratch.resize(count);
+        for (int p = 0; p < passes; p++) {
+            int shift = p * digitBits;
+            Uint32* h = histogram[p];
+
+            // Mọi key cùng một digit thì pass này không đổi thứ tự
+            if (h[(entries[0].key >> shift) & (buckets - 1)] == count)
+                continue;
+
+            Uint32 sum = 0;
+            for (int b = 0; b < buckets; b++) {
+                Uint32 n = h[b];
+                h[b] = sum;
+                sum += n;
+            }
+            for (const Entry& e : entries)
+                scratch[h[(e.key >> shift) & (buckets - 1)]++] = e;
+            entries.swap(scratch);
+        }
+    }
+
+  public:
+    // Flip floats so unsigned integer order matches float order: negative
+    // values get all bits inverted, positive ones just the sign bit
+    static Uint32 Key(float depth)
+    {
+        Uint32 bits;
+        memcpy(&bits, &depth, sizeof(bits));
+        return bits & 0x80000000u ? ~bits : bits | 0x80000000u;
+    }
+
+    // Indices of depths[0, count) in ascending depth order (front to back).
+    // The returned array stays valid until the next call.
+    const std::vector<Uint32>& Sort(const float* depths, size_t count)
+    {
+        entries.resize(count);
+        if (count == 0) {
+            order.clear();
+            return order;
+        }
+
+        bool coherent = order.size() == count;
+        if (skipFrames > 0) {
+            skipFrames--;
+            coherent = false;
+        }
+        for (size_t i = 0; i < count; i++) {
+            Uint32 index = coherent ? order[i] : (Uint32)i;
+            entries[i] = { Key(depths[index]), index };
+        }
+
+        if (coherent && InsertionSort(count / 4)) {
+            coherentFrames++;
+            backoff = 0;
+        } else {
+            if (coherent) {
+                backoff = backoff ? SDL_min(backoff * 2, 32) : 1;
+                skipFrames = backoff;
+            }
+            RadixSort();
+            radixFrames++;
+        }
+
+        order.resize(count);
+        for (size_t i = 0; i < count; i++)
+            order[i] = entries[i].index;
+        return order;
+    }
+
+    // Forget the previous order, e.g. when the triangle list is rebuilt
+    void Reset()
+    {
+        order.clear();
+        backoff = skipFrames = 0;
+    }
+
+    int GetRadixFrames() const { return radixFrames; }
+    int GetCoherentFrames() const { return coherentFrames; }
+};
@@ -0,0 +1,119 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <vector>
+
+// Signed distance fields from antialiased coverage, with the exact Euclidean
+// distance transform of Felzenszwalb and Huttenlocher: a lower envelope of
+// parabolas per row and then per column, linear in the number of pixels.
+
+// Squared distance transform of one line: d[q] = min over p of
+// (q - p)^2 + f[p]. `v` holds n ints and `z` n + 1 doubles of scratch.
+static inline void
+distanceTransform1D(const double* f, double* d, int* v, double* z, int n)
+{
+    const double inf = 1e20;
+    int k = 0;
+    v[0] = 0;
+    z[0] = -inf;
+    z[1] = inf;
+    for (int q = 1; q < n; q++) {
+        double s;
+        for (;;) {
+            int p = v[k];
+            s = ((f[q] + (double)q * q) - (f[p] + (double)p * p)) /
+                (2.0 * (q - p));
+            if (s > z[k])
+                break;
+            k--; // z[0] = -inf nên không bao giờ xuống dưới 0
+        }
+        k++;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = inf;
+    }
+
+    k = 0;
+    for (int q = 0; q < n; q++) {
+        while (z[k + 1] < q)
+            k++;
+        d[q] = (double)(q - v[k]) * (q - v[k]) + f[v[k]];
+    }
+}
+
+// Squared distance from every pixel of a w x h grid to the nearest pixel
+// where `seed` is set, in place of `grid` (which only needs to be sized)
+static inline void
+distanceTransform2D(const std::vector<bool>& seed,
+                    std::vector<double>& grid,
+                    int w,
+                    int h)
+{
+    const int n = SDL_max(w, h);
+    std::vector<double> f(n), d(n), z(n + 1);
+    std::vector<int> v(n);
+
+    for (int i = 0; i < w * h; i++)
+        grid[i] = seed[i] ? 0.0 : 1e20;
+
+    for (int x = 0; x < w; x++) {
+        for (int y = 0; y < h; y++)
+            f[y] = grid[y * w + x];
+        distanceTransform1D(f.data(), d.data(), v.data(), z.data(), h);
+        for (int y = 0; y < h; y++)
+            grid[y * w + x] = d[y];
+    }
+    for (int y = 0; y < h; y++) {
+        distanceTransform1D(&grid[y * w], d.data(), v.data(), z.data(), w);
+        for (int x = 0; x < w; x++)
+            grid[y * w + x] = d[x];
+    }
+}
+
+// Distance field of a w x h coverage mask (0..255). `field` is
+// (w + 2 * spread) x (h + 2 * spread): the mask centered with `spread`
+// pixels of margin, 128 on the outline, rising inside and falling outside
+// by 255 / (2 * spread) per pixel of distance. Edge pixels take their distance
+// from the antialiased coverage, so the outline keeps subpixel position.
+static inline void
+makeDistanceField(const Uint8* coverage,
+                  int w,
+                  int h,
+                  int spread,
+                  Uint8* field)
+{
+    const int fw = w + 2 * spread, fh = h + 2 * spread;
+    std::vector<bool> inside((size_t)fw * fh, false);
+    std::vector<bool> outside((size_t)fw * fh, true);
+    for (int y = 0; y < h; y++)
+        for (int x = 0; x < w; x++) {
+            bool in = coverage[y * w + x] >= 128;
+            size_t i = (size_t)(y + spread) * fw + x + spread;
+            inside[i] = in;
+            outside[i] = !in;
+        }
+
+    // Khoảng cách tới điểm trong gần nhất và tới điểm ngoài gần nhất
+    std::vector<double> toInside((size_t)fw * fh), toOutside((size_t)fw * fh);
+    distanceTransform2D(inside, toInside, fw, fh);
+    distanceTransform2D(outside, toOutside, fw, fh);
+
+    for (int y = 0; y < fh; y++)
+        for (int x = 0; x < fw; x++) {
+            size_t i = (size_t)y * fw + x;
+            float distance; // positive inside
+            int cx = x - spread, cy = y - spread;
+            Uint8 a = 0;
+            if (cx >= 0 && cx < w && cy >= 0 && cy < h)
+                a = coverage[cy * w + cx];
+
+            if (a > 0 && a < 255)
+                distance = a / 255.0f - 0.5f;
+            else if (inside[i])
+                distance = SDL_sqrtf((float)toOutside[i]) - 0.5f;
+            else
+                distance = 0.5f - SDL_sqrtf((float)toInside[i]);
+
+            float value = 0.5f + distance * 0.5f / spread;
+            field[i] = (Uint8)(SDL_clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+        }
+}
@@ -0,0 +1,146 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <vector>
+
+// Frame pacing shared by the demos: a fixed-step update clock with an
+// interpolation factor for rendering, sleep-then-spin pacing to a target
+// frame rate, and periodic frame-time percentiles. When the renderer has
+// vsync enabled, SDL_RenderPresent already blocks, so pacing is skipped and
+// only the statistics are collected.
+class FrameScheduler
+{
+  private:
+    const char* name;
+    Uint64 framePeriod;  // ns
+    Uint64 updateStep;   // ns
+    Uint64 accumulator = 0;
+    Uint64 lastBegin = 0;
+    Uint64 lastFrame = 0;
+    Uint64 deadline = 0;
+    bool vsync = false;
+
+    // Sleep stops this long before the deadline and the rest is spun;
+    // it follows the worst oversleep seen so far, decaying slowly
+    Uint64 spinMargin = SDL_NS_PER_MS;
+    static constexpr Uint64 minSpinMargin = SDL_NS_PER_MS / 4;
+
+    std::vector<float> samples; // ms
+    Uint64 lastReport = 0;
+    Uint64 reportInterval;
+
+    static constexpr int maxSteps = 8;
+
+    void pace()
+    {
+        Uint64 now = SDL_GetTicksNS();
+        if (deadline == 0 || now > deadline + framePeriod) {
+            // Quá trễ thì bắt đầu lịch mới thay vì chạy bù liên tục
+            deadline = now + framePeriod;
+        } else {
+            deadline += framePeriod;
+        }
+
+        if (deadline > now + spinMargin) {
+            Uint64 request = deadline - now - spinMargin;
+            SDL_DelayNS(request);
+            Uint64 slept = SDL_GetTicksNS() - now;
+            Uint64 over = slept > request ? slept - request : 0;
+            spinMargin =
+              std::max({ spinMargin - spinMargin / 64, over, minSpinMargin });
+        }
+        while (SDL_GetTicksNS() < deadline) {
+        }
+    }
+
+    void report(Uint64 now)
+    {
+        if (lastReport == 0)
+            lastReport = now;
+        if (now - lastReport < reportInterval || samples.empty())
+            return;
+
+        std::sort(samples.begin(), samples.end());
+        auto percentile = [&](float p) {
+            size_t i = (size_t)(p * (samples.size() - 1) + 0.5f);
+            return samples[i];
+        };
+        SDL_Log("%s: frame ms p50 %.2f p95 %.2f p99 %.2f max %.2f "
+                "(target %.2f, %s, %zu frames)",
+                name,
+                percentile(0.50f),
+                percentile(0.95f),
+                percentile(0.99f),
+                samples.back(),
+                framePeriod / 1e6,
+                vsync ? "vsync" : "paced",
+                samples.size());
+        samples.clear();
+        lastReport = now;
+    }
+
+  public:
+    FrameScheduler(const char* name,
+                   double targetHz = 60.0,
+                   double updateHz = 120.0,
+                   double reportSeconds = 5.0)
+      : name(name)
+      , framePeriod((Uint64)(SDL_NS_PER_SECOND / targetHz))
+      , updateStep((Uint64)(SDL_NS_PER_SECOND / updateHz))
+      , reportInterval((Uint64)(SDL_NS_PER_SECOND * reportSeconds))
+    {
+    }
+
+    // Read the renderer's vsync state; call again after changing it
+    void setVSync(SDL_Renderer* renderer)
+    {
+        int interval = 0;
+        vsync = SDL_GetRenderVSync(renderer, &interval) && interval != 0;
+    }
+
+    // Số bước update cố định đến hạn kể từ frame trước (tối đa maxSteps để
+    // không bị "spiral of death" sau khi bị treo)
+    int beginFrame()
+    {
+        Uint64 now = SDL_GetTicksNS();
+        if (lastBegin == 0)
+            lastBegin = now;
+        accumulator += now - lastBegin;
+        lastBegin = now;
+
+        int steps = (int)(accumulator / updateStep);
+        if (steps > maxSteps) {
+            steps = maxSteps;
+            accumulator = 0;
+        } else {
+            accumulator -= steps * updateStep;
+        }
+        return steps;
+    }
+
+    float getStep() const { return updateStep / (float)SDL_NS_PER_SECOND; }
+
+    // Interpolation factor between the previous and current update state
+    float getAlpha() const { return accumulator / (float)updateStep; }
+
+    // Call after SDL_RenderPresent
+    void endFrame()
+    {
+        if (!vsync)
+            pace();
+
+        Uint64 now = SDL_GetTicksNS();
+        if (lastFrame != 0)
+            samples.push_back((now - lastFrame) / 1e6f);
+        lastFrame = now;
+        report(now);
+    }
+
+    // Call instead of endFrame() when nothing was presented: nothing blocked
+    // on vsync, so always pace, and don't count it as a frame
+    void skipFrame()
+    {
+        pace();
+        lastFrame = SDL_GetTicksNS();
+    }
+};
@@ -0,0 +1,561 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include "atlas_packer.h"
+#include "distance_field.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// Glyphs rasterized once per (font, size, codepoint) into shared atlas
+// textures. Each glyph is rendered white with TTF_RenderGlyph_Blended, trimmed
+// to its visible pixels and uploaded into a skyline-packed page (a new page
+// when the current ones are full), so text of any color is drawn by tinting
+// quads of the same atlas. Glyphs without pixels (spaces) only carry their
+// advance.
+//
+// In Sdf mode glyphs are rasterized once at sdfSize whatever the font's size
+// and stored as signed distance fields (gray, 128 on the outline), computed
+// in parallel for the glyphs of one prepare(). One atlas then serves every
+// size: TextLayout scales the quads by getScale() and SdfText turns the
+// field back into sharp coverage.
+//
+// A CPU copy of every page is kept so the cache of one font can be written
+// to disk with save() and read back with load() on the next start, which
+// skips FreeType rasterization for every glyph already in the file.
+class GlyphCache
+{
+  public:
+    enum Mode
+    {
+        Bitmap,
+        Sdf
+    };
+
+    // Sdf mode: the raster size, and how far the field reaches on each side
+    // of the outline, in pixels at that size
+    static constexpr float sdfSize = 48.0f;
+    static constexpr int sdfSpread = 6;
+
+    struct Glyph
+    {
+        SDL_Texture* texture; // null when the glyph has no pixels
+        SDL_FRect src;
+        float offsetX, offsetY; // of the pixels from the pen, at line top
+        float advance;
+    };
+
+  private:
+    struct Key
+    {
+        const TTF_Font* font;
+        float size;
+        Uint32 codepoint;
+
+        bool operator==(const Key&) const = default;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& k) const
+        {
+            Uint32 size;
+            memcpy(&size, &k.size, sizeof(size));
+            size_t h = (size_t)k.font;
+            h ^= (size_t)k.codepoint * 0x9E3779B97F4A7C15ull + (h >> 7);
+            h ^= (size_t)size * 0xC2B2AE3D27D4EB4Full + (h << 6);
+            return h;
+        }
+    };
+
+    struct Page
+    {
+        SDL_Texture* texture;
+        SkylinePacker packer;
+        std::vector<Uint32> pixels;  // pageSize * pageSize, ARGB8888
+        std::vector<SDL_Rect> placed; // packer inserts, in order
+    };
+
+    // Cache file: Header, then per page its placed count, used height,
+    // placed rects and pixel rows, then glyphCount FileGlyph records.
+    // Native byte order; a file from another build just fails to load.
+    struct Header
+    {
+        char magic[4];
+        Uint32 version;
+        Uint64 fontHash;
+        float size;
+        Uint32 mode;
+        Uint32 pageSize;
+        Uint32 pageCount;
+        Uint32 glyphCount;
+    };
+
+    struct FileGlyph
+    {
+        Uint32 codepoint;
+        Sint32 page; // -1 when the glyph has no pixels
+        SDL_FRect src;
+        float offsetX, offsetY, advance;
+    };
+
+    static constexpr char fileMagic[4] = { 'G', 'L', 'Y', 'C' };
+    static constexpr Uint32 fileVersion = 2;
+
+    // A glyph between rasterizing and packing
+    struct Pending
+    {
+        Uint32 codepoint;
+        Glyph glyph; // metrics; texture and src are set when it is placed
+        int w = 0, h = 0;
+        std::vector<Uint32> pixels; // w * h, ARGB8888
+    };
+
+    // Viền trong suốt để lọc tuyến tính không lấy màu glyph bên cạnh
+    static constexpr int padding = 1;
+
+    SDL_Renderer* renderer;
+    int pageSize;
+    Mode mode;
+    std::vector<Page> pages;
+    std::unordered_map<Key, Glyph, KeyHash> glyphs;
+    std::unique_ptr<ThreadPool> pool; // Sdf mode, made on first use
+    Glyph solid = {};                 // white patch, see getSolid()
+
+    size_t rasterized = 0;
+    Uint64 rasterTime = 0; // ns
+
+    Page* addPage()
+    {
+        SDL_Texture* t = SDL_CreateTexture(renderer,
+                                           SDL_PIXELFORMAT_ARGB8888,
+                                           SDL_TEXTUREACCESS_STATIC,
+                                           pageSize,
+                                           pageSize);
+        if (!t)
+            return nullptr;
+        if (mode == Sdf) {
+            // Trường khoảng cách của các glyph chồng nhau lấy giá trị lớn nhất
+            SDL_SetTextureBlendMode(
+              t,
+              SDL_ComposeCustomBlendMode(SDL_BLENDFACTOR_ONE,
+                                         SDL_BLENDFACTOR_ONE,
+                                         SDL_BLENDOPERATION_MAXIMUM,
+                                         SDL_BLENDFACTOR_ONE,
+                                         SDL_BLENDFACTOR_ONE,
+                                         SDL_BLENDOPERATION_MAXIMUM));
+            SDL_SetTextureScaleMode(t, SDL_SCALEMODE_LINEAR);
+        } else {
+            SDL_SetTextureBlendMode(t, SDL_BLENDMODE_BLEND);
+        }
+        pages.push_back({ t, SkylinePacker(pageSize, pageSize), {}, {} });
+        pages.back().pixels.assign((size_t)pageSize * pageSize, 0);
+        return &pages.back();
+    }
+
+    bool insert(Page& page, int w, int h, SDL_Rect& rect)
+    {
+        if (!page.packer.insert(w, h, rect))
+            return false;
+        page.placed.push_back(rect);
+        return true;
+    }
+
+    Page* allocate(int w, int h, SDL_Rect& rect)
+    {
+        for (Page& page : pages)
+            if (insert(page, w, h, rect))
+                return &page;
+
+        Page* page = addPage();
+        if (!page)
+            return nullptr;
+        SDL_UpdateTexture(
+          page->texture, nullptr, page->pixels.data(), pageSize * 4);
+        if (!insert(*page, w, h, rect))
+            return nullptr; // lớn hơn cả một trang
+        return page;
+    }
+
+    // Render `codepoint` white at the font's current size, trimmed to its
+    // visible pixels
+    Pending rasterize(TTF_Font* font, Uint32 codepoint)
+    {
+        Pending pending;
+        pending.codepoint = codepoint;
+        pending.glyph = {};
+        int advance = 0;
+        TTF_GetGlyphMetrics(
+          font, codepoint, nullptr, nullptr, nullptr, nullptr, &advance);
+        pending.glyph.advance = (float)advance;
+
+        const SDL_Color white = { 255, 255, 255, 255 };
+        SDL_Surface* surface = TTF_RenderGlyph_Blended(font, codepoint, white);
+        if (!surface)
+            return pending;
+        if (surface->format != SDL_PIXELFORMAT_ARGB8888) {
+            SDL_Surface* converted =
+              SDL_ConvertSurface(surface, SDL_PIXELFORMAT_ARGB8888);
+            SDL_DestroySurface(surface);
+            if (!converted)
+                return pending;
+            surface = converted;
+        }
+
+        // Cắt phần trong suốt xung quanh
+        int minX = surface->w, minY = surface->h, maxX = -1, maxY = -1;
+        for (int y = 0; y < surface->h; y++) {
+            const Uint32* row =
+              (const Uint32*)((const Uint8*)surface->pixels +
+                              y * surface->pitch);
+            for (int x = 0; x < surface->w; x++) {
+                if (row[x] >> 24) {
+                    minX = SDL_min(minX, x);
+                    maxX = SDL_max(maxX, x);
+                    minY = SDL_min(minY, y);
+                    maxY = SDL_max(maxY, y);
+                }
+            }
+        }
+
+        if (maxX >= 0) {
+            pending.w = maxX - minX + 1;
+            pending.h = maxY - minY + 1;
+            pending.pixels.resize((size_t)pending.w * pending.h);
+            const Uint8* pixels =
+              (const Uint8*)surface->pixels + minY * surface->pitch + minX * 4;
+            for (int y = 0; y < pending.h; y++)
+                memcpy(&pending.pixels[(size_t)y * pending.w],
+                       pixels + y * surface->pitch,
+                       (size_t)pending.w * 4);
+            pending.glyph.offsetX = (float)minX;
+            pending.glyph.offsetY = (float)minY;
+        }
+        SDL_DestroySurface(surface);
+        return pending;
+    }
+
+    // Replace the coverage of `pending` with its distance field, opaque gray.
+    // Touches nothing but `pending`, so glyphs can be converted in parallel.
+    static void toDistanceField(Pending& pending)
+    {
+        if (pending.w == 0)
+            return;
+        const int w = pending.w + 2 * sdfSpread, h = pending.h + 2 * sdfSpread;
+        std::vector<Uint8> coverage(pending.pixels.size());
+        for (size_t i = 0; i < coverage.size(); i++)
+            coverage[i] = (Uint8)(pending.pixels[i] >> 24);
+        std::vector<Uint8> field((size_t)w * h);
+        makeDistanceField(
+          coverage.data(), pending.w, pending.h, sdfSpread, field.data());
+
+        pending.pixels.resize(field.size());
+        for (size_t i = 0; i < field.size(); i++)
+            pending.pixels[i] = 0xFF000000u | field[i] * 0x010101u;
+        pending.w = w;
+        pending.h = h;
+        pending.glyph.offsetX -= sdfSpread;
+        pending.glyph.offsetY -= sdfSpread;
+    }
+
+    // Pack and upload the pixels of `pending`
+    Glyph place(Pending& pending)
+    {
+        Glyph glyph = pending.glyph;
+        SDL_Rect rect;
+        const int w = pending.w, h = pending.h;
+        Page* page = nullptr;
+        if (w > 0)
+            page = allocate(w + 2 * padding, h + 2 * padding, rect);
+        if (!page)
+            return glyph;
+
+        SDL_Rect dst = { rect.x + padding, rect.y + padding, w, h };
+        for (int y = 0; y < h; y++)
+            memcpy(&page->pixels[(size_t)(dst.y + y) * pageSize + dst.x],
+                   &pending.pixels[(size_t)y * w],
+                   (size_t)w * 4);
+        SDL_UpdateTexture(page->texture, &dst, pending.pixels.data(), w * 4);
+
+        glyph.texture = page->texture;
+        glyph.src = { (float)dst.x, (float)dst.y, (float)w, (float)h };
+        return glyph;
+    }
+
+    // Rasterize, convert and place `count` glyphs that are not cached yet.
+    // FreeType only runs on this thread; the distance fields use the pool.
+    void bake(TTF_Font* font, const Uint32* codepoints, int count)
+    {
+        if (count <= 0)
+            return;
+        const Uint64 start = SDL_GetTicksNS();
+        const float size = TTF_GetFontSize(font);
+        const float rasterSize = getRasterSize(font);
+
+        std::vector<Pending> pending(count);
+        if (rasterSize != size)
+            TTF_SetFontSize(font, rasterSize);
+        for (int i = 0; i < count; i++)
+            pending[i] = rasterize(font, codepoints[i]);
+        if (rasterSize != size)
+            TTF_SetFontSize(font, size);
+
+        if (mode == Sdf && count > 1) {
+            if (!pool)
+                pool = std::make_unique<ThreadPool>();
+            pool->ParallelFor(
+              count, [&](int i, int) { toDistanceField(pending[i]); });
+        } else if (mode == Sdf) {
+            toDistanceField(pending[0]);
+        }
+
+        for (Pending& p : pending)
+            glyphs.emplace(Key{ font, rasterSize, p.codepoint }, place(p));
+        rasterized += count;
+        rasterTime += SDL_GetTicksNS() - start;
+    }
+
+  public:
+    explicit GlyphCache(SDL_Renderer* r, int pageSize = 1024, Mode m = Bitmap)
+      : renderer(r)
+      , pageSize(pageSize)
+      , mode(m)
+    {
+    }
+
+    GlyphCache(const GlyphCache&) = delete;
+    GlyphCache& operator=(const GlyphCache&) = delete;
+
+    ~GlyphCache() { clear(); }
+
+    // The glyph for `codepoint` at the font's current size (in Sdf mode at
+    // sdfSize; scale it by getScale()), rasterized on first use. The
+    // reference stays valid until clear().
+    const Glyph& get(TTF_Font* font, Uint32 codepoint)
+    {
+        Key key = { font, getRasterSize(font), codepoint };
+        auto it = glyphs.find(key);
+        if (it == glyphs.end()) {
+            bake(font, &codepoint, 1);
+            it = glyphs.find(key);
+        }
+        return it->second;
+    }
+
+    // Rasterize every glyph of the UTF-8 `text` that is missing, all in one
+    // go (in parallel in Sdf mode). Returns how many were added.
+    int prepare(TTF_Font* font, const char* text)
+    {
+        const float rasterSize = getRasterSize(font);
+        std::vector<Uint32> missing;
+        size_t length = SDL_strlen(text);
+        while (length > 0) {
+            Uint32 codepoint = SDL_StepUTF8(&text, &length);
+            if (codepoint != '\n' &&
+                !glyphs.count(Key{ font, rasterSize, codepoint }) &&
+                std::find(missing.begin(), missing.end(), codepoint) ==
+                  missing.end())
+                missing.push_back(codepoint);
+        }
+        bake(font, missing.data(), (int)missing.size());
+        return (int)missing.size();
+    }
+
+    // A white patch in the atlas, so flat rectangles can be drawn in the same
+    // batch as text by tinting it (Bitmap mode; Sdf pages are not colors).
+    // Made on first use: call load() before it.
+    bool getSolid(SDL_Texture*& texture, SDL_FRect& src)
+    {
+        if (!solid.texture) {
+            // 4x4 trắng, chỉ lấy 2x2 ở giữa để lọc tuyến tính vẫn ra trắng
+            const int size = 4;
+            SDL_Rect rect;
+            Page* page = allocate(size, size, rect);
+            if (!page)
+                return false;
+            std::vector<Uint32> white(size * size, 0xFFFFFFFFu);
+            for (int y = 0; y < size; y++)
+                memcpy(&page->pixels[(size_t)(rect.y + y) * pageSize + rect.x],
+                       &white[y * size],
+                       size * 4);
+            SDL_UpdateTexture(page->texture, &rect, white.data(), size * 4);
+            solid.texture = page->texture;
+            solid.src = { rect.x + 1.0f, rect.y + 1.0f, 2.0f, 2.0f };
+        }
+        texture = solid.texture;
+        src = solid.src;
+        return true;
+    }
+
+    Mode getMode() const { return mode; }
+
+    // Size the glyphs of `font` are rasterized at
+    float getRasterSize(TTF_Font* font) const
+    {
+        return mode == Sdf ? sdfSize : TTF_GetFontSize(font);
+    }
+
+    // Glyph metrics and quads times this give the font's current size
+    float getScale(TTF_Font* font) const
+    {
+        return mode == Sdf ? TTF_GetFontSize(font) / sdfSize : 1.0f;
+    }
+
+    // Drop every glyph of `font`; call before closing it, since a font opened
+    // later may get the same address. Its atlas space is not reclaimed.
+    void forget(const TTF_Font* font)
+    {
+        std::erase_if(glyphs, [&](const auto& g) {
+            return g.first.font == font;
+        });
+    }
+
+    // Write the glyphs of `font` at its raster size and the pages they
+    // live on to `path`. `fontHash` identifies the font data (hashFont()),
+    // since the font pointer means nothing to the next run.
+    bool save(const char* path, TTF_Font* font, Uint64 fontHash) const
+    {
+        const float size = getRasterSize(font);
+        std::vector<FileGlyph> records;
+        for (const auto& [key, glyph] : glyphs) {
+            if (key.font != font || key.size != size)
+                continue;
+            FileGlyph r = { key.codepoint, -1, glyph.src, glyph.offsetX,
+                            glyph.offsetY, glyph.advance };
+            for (size_t i = 0; i < pages.size(); i++)
+                if (pages[i].texture == glyph.texture)
+                    r.page = (Sint32)i;
+            records.push_back(r);
+        }
+
+        Header header = { {},
+                          fileVersion,
+                          fontHash,
+                          size,
+                          (Uint32)mode,
+                          (Uint32)pageSize,
+                          (Uint32)pages.size(),
+                          (Uint32)records.size() };
+        memcpy(header.magic, fileMagic, sizeof(fileMagic));
+
+        std::vector<Uint8> out;
+        auto write = [&](const void* data, size_t n) {
+            out.insert(out.end(), (const Uint8*)data, (const Uint8*)data + n);
+        };
+        write(&header, sizeof(header));
+        for (const Page& page : pages) {
+            // Chỉ ghi các hàng đã dùng
+            Uint32 count = (Uint32)page.placed.size();
+            Uint32 used = (Uint32)page.packer.getUsedHeight();
+            write(&count, sizeof(count));
+            write(&used, sizeof(used));
+            write(page.placed.data(), count * sizeof(SDL_Rect));
+            write(page.pixels.data(), (size_t)used * pageSize * 4);
+        }
+        write(records.data(), records.size() * sizeof(FileGlyph));
+        return SDL_SaveFile(path, out.data(), out.size());
+    }
+
+    // Read a file written by save() for `font` at its raster size into an
+    // empty cache. Fails (with SDL_GetError() set) when the file is missing,
+    // damaged, or was written for other font data, size, mode or page size.
+    bool load(const char* path, TTF_Font* font, Uint64 fontHash)
+    {
+        if (!pages.empty() || !glyphs.empty())
+            return SDL_SetError("glyph cache is not empty");
+
+        size_t length = 0;
+        Uint8* data = (Uint8*)SDL_LoadFile(path, &length);
+        if (!data)
+            return false;
+        size_t at = 0;
+        auto read = [&](void* dst, size_t n) {
+            if (length - at < n)
+                return false;
+            memcpy(dst, data + at, n);
+            at += n;
+            return true;
+        };
+
+        const float size = getRasterSize(font);
+        Header header;
+        bool ok = read(&header, sizeof(header)) &&
+                  memcmp(header.magic, fileMagic, sizeof(fileMagic)) == 0 &&
+                  header.version == fileVersion &&
+                  header.fontHash == fontHash && header.size == size &&
+                  header.mode == (Uint32)mode &&
+                  header.pageSize == (Uint32)pageSize;
+        if (!ok)
+            SDL_SetError("%s: not a glyph cache for this font", path);
+
+        for (Uint32 p = 0; ok && p < header.pageCount; p++) {
+            Uint32 count = 0, used = 0;
+            ok = read(&count, sizeof(count)) && read(&used, sizeof(used)) &&
+                 used <= (Uint32)pageSize;
+            Page* page = ok ? addPage() : nullptr;
+            ok = page != nullptr;
+
+            // Xếp lại đúng thứ tự cũ để packer tiếp tục được từ chỗ cũ
+            for (Uint32 i = 0; ok && i < count; i++) {
+                SDL_Rect saved, rect;
+                ok = read(&saved, sizeof(saved)) &&
+                     insert(*page, saved.w, saved.h, rect) &&
+                     rect.x == saved.x && rect.y == saved.y;
+            }
+            ok = ok && read(page->pixels.data(), (size_t)used * pageSize * 4);
+            if (ok)
+                SDL_UpdateTexture(
+                  page->texture, nullptr, page->pixels.data(), pageSize * 4);
+            else
+                SDL_SetError("%s: damaged glyph cache", path);
+        }
+
+        for (Uint32 g = 0; ok && g < header.glyphCount; g++) {
+            FileGlyph r;
+            ok = read(&r, sizeof(r)) && r.page < (Sint32)pages.size();
+            if (!ok) {
+                SDL_SetError("%s: damaged glyph cache", path);
+                break;
+            }
+            Glyph glyph = { r.page >= 0 ? pages[r.page].texture : nullptr,
+                            r.src,
+                            r.offsetX,
+                            r.offsetY,
+                            r.advance };
+            glyphs.emplace(Key{ font, size, r.codepoint }, glyph);
+        }
+
+        SDL_free(data);
+        if (!ok)
+            clear();
+        return ok;
+    }
+
+    // FNV-1a over the font file, for save() and load()
+    static Uint64 hashFont(const void* data, size_t size)
+    {
+        Uint64 h = 0xCBF29CE484222325ull;
+        for (size_t i = 0; i < size; i++) {
+            h ^= ((const Uint8*)data)[i];
+            h *= 0x100000001B3ull;
+        }
+        return h;
+    }
+
+    void clear()
+    {
+        for (Page& page : pages)
+            SDL_DestroyTexture(page.texture);
+        pages.clear();
+        glyphs.clear();
+        solid = {};
+    }
+
+    size_t getGlyphCount() const { return glyphs.size(); }
+    size_t getPageCount() const { return pages.size(); }
+    size_t getRasterizedCount() const { return rasterized; }
+    Uint64 getRasterTime() const { return rasterTime; }
+};
@@ -0,0 +1,216 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// Input layer shared by the demos. Events are pushed into a fixed ring as
+// they arrive (from SDL_AppEvent, or poll() in a main loop) and drained once
+// per frame, where bursts are coalesced: a run of mouse motion becomes one
+// event with the last position and summed xrel/yrel, and of several resizes
+// of a window only the last is kept. The ring is single-producer
+// single-consumer without locks, so push() and drain() may run on two
+// different threads.
+//
+// Every input event carries its SDL timestamp. Call presented() right after
+// SDL_RenderPresent: the time from each input drained since the last call
+// to then is recorded as input-to-photon latency (really to the return of
+// SDL_RenderPresent, the last point the renderer exposes) and its
+// percentiles are logged periodically. Call skipped() instead when a frame
+// presents nothing, so input that changed nothing is not counted.
+//
+// Pointers inside events (text input, dropped file names) stay valid only
+// until SDL pumps events again; handle them in the frame they are drained.
+class InputPump
+{
+  private:
+    static constexpr size_t capacity = 1024; // power of two
+
+    const char* name;
+    std::unique_ptr<SDL_Event[]> ring;
+    std::atomic<size_t> head{ 0 }; // next to write, producer only
+    std::atomic<size_t> tail{ 0 }; // next to read, consumer only
+    std::atomic<Uint64> dropped{ 0 };
+
+    std::vector<SDL_Event> events; // last drain()
+    std::vector<Uint64> pending;   // timestamps of input not yet presented
+
+    std::vector<float> samples; // ms
+    Uint64 received = 0, coalesced = 0;
+    Uint64 droppedBefore = 0; // dropped at the last report
+    Uint64 lastReport = 0;
+    Uint64 reportInterval;
+
+    // Producer side
+    bool full() const
+    {
+        return head.load(std::memory_order_relaxed) -
+                 tail.load(std::memory_order_acquire) ==
+               capacity;
+    }
+
+    static bool isInput(Uint32 type)
+    {
+        switch (type) {
+            case SDL_EVENT_KEY_DOWN:
+            case SDL_EVENT_KEY_UP:
+            case SDL_EVENT_TEXT_INPUT:
+            case SDL_EVENT_MOUSE_MOTION:
+            case SDL_EVENT_MOUSE_BUTTON_DOWN:
+            case SDL_EVENT_MOUSE_BUTTON_UP:
+            case SDL_EVENT_MOUSE_WHEEL:
+            case SDL_EVENT_FINGER_DOWN:
+            case SDL_EVENT_FINGER_UP:
+            case SDL_EVENT_FINGER_MOTION:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    static bool isResize(Uint32 type)
+    {
+        return type == SDL_EVENT_WINDOW_RESIZED ||
+               type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED;
+    }
+
+    // Fold `e` into what was drained so far; false if it has to be added
+    bool coalesce(const SDL_Event& e)
+    {
+        if (events.empty())
+            return false;
+        if (e.type == SDL_EVENT_MOUSE_MOTION) {
+            // Chỉ gộp với event ngay trước, để click vẫn thấy đúng vị trí
+            SDL_MouseMotionEvent& last = events.back().motion;
+            if (last.type != SDL_EVENT_MOUSE_MOTION ||
+                last.windowID != e.motion.windowID ||
+                last.which != e.motion.which)
+                return false;
+            // Keeps the first timestamp: latency counts from the oldest
+            // input the merged event stands for
+            last.state = e.motion.state;
+            last.x = e.motion.x;
+            last.y = e.motion.y;
+            last.xrel += e.motion.xrel;
+            last.yrel += e.motion.yrel;
+            return true;
+        }
+        if (isResize(e.type)) {
+            for (SDL_Event& earlier : events)
+                if (earlier.type == e.type &&
+                    earlier.window.windowID == e.window.windowID) {
+                    earlier = e;
+                    return true;
+                }
+        }
+        return false;
+    }
+
+    void report(Uint64 now)
+    {
+        if (lastReport == 0)
+            lastReport = now;
+        if (now - lastReport < reportInterval || samples.empty())
+            return;
+
+        std::sort(samples.begin(), samples.end());
+        auto percentile = [&](float p) {
+            size_t i = (size_t)(p * (samples.size() - 1) + 0.5f);
+            return samples[i];
+        };
+        Uint64 drops = dropped.load(std::memory_order_relaxed);
+        SDL_Log("%s: input latency ms p50 %.2f p95 %.2f p99 %.2f max %.2f "
+                "(%zu inputs presented; %llu events, %llu coalesced, %llu "
+                "dropped)",
+                name,
+                percentile(0.50f),
+                percentile(0.95f),
+                percentile(0.99f),
+                samples.back(),
+                samples.size(),
+                (unsigned long long)received,
+                (unsigned long long)coalesced,
+                (unsigned long long)(drops - droppedBefore));
+        samples.clear();
+        received = coalesced = 0;
+        droppedBefore = drops;
+        lastReport = now;
+    }
+
+  public:
+    explicit InputPump(const char* name, double reportSeconds = 5.0)
+      : name(name)
+      , ring(new SDL_Event[capacity])
+      , reportInterval((Uint64)(SDL_NS_PER_SECOND * reportSeconds))
+    {
+    }
+
+    InputPump(const InputPump&) = delete;
+    InputPump& operator=(const InputPump&) = delete;
+
+    // Producer side. Returns false (and counts it) when the ring is full.
+    bool push(const SDL_Event* event)
+    {
+        if (full()) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        size_t h = head.load(std::memory_order_relaxed);
+        SDL_Event& slot = ring[h & (capacity - 1)];
+        slot = *event;
+        if (slot.common.timestamp == 0) // pushed without one
+            slot.common.timestamp = SDL_GetTicksNS();
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Move SDL's queue into the ring, for demos with their own main loop.
+    // Stops when the ring is full; the rest waits in SDL's queue.
+    void poll()
+    {
+        SDL_Event event;
+        while (!full() && SDL_PollEvent(&event))
+            push(&event);
+    }
+
+    // Consumer side, once per frame: everything pushed since the last call,
+    // in order, coalesced. The vector is reused by the next call.
+    const std::vector<SDL_Event>& drain()
+    {
+        events.clear();
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t h = head.load(std::memory_order_acquire);
+        for (; t != h; t++) {
+            const SDL_Event& e = ring[t & (capacity - 1)];
+            received++;
+            if (coalesce(e))
+                coalesced++;
+            else
+                events.push_back(e);
+        }
+        tail.store(t, std::memory_order_release);
+
+        for (const SDL_Event& e : events)
+            if (isInput(e.type))
+                pending.push_back(e.common.timestamp);
+        return events;
+    }
+
+    // Call after SDL_RenderPresent
+    void presented()
+    {
+        Uint64 now = SDL_GetTicksNS();
+        for (Uint64 t : pending)
+            samples.push_back(now > t ? (now - t) / 1e6f : 0.0f);
+        pending.clear();
+        report(now);
+    }
+
+    // Call instead of presented() for a frame that showed nothing
+    void skipped()
+    {
+        pending.clear();
+        report(SDL_GetTicksNS());
+    }
+};
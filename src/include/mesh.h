@@ -0,0 +1,451 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <glm/glm.hpp>
+#include <charconv>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+struct Vertex
+{
+    glm::vec3 position;
+    glm::vec3 color;
+};
+
+// The binary format stores Vertex arrays verbatim
+static_assert(sizeof(Vertex) == 24 && std::is_trivially_copyable_v<Vertex>);
+
+// Read-only memory mapping of a whole file
+class MappedFile
+{
+  private:
+    const Uint8* data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#endif
+
+  public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile() { Close(); }
+
+    bool Open(const char* path)
+    {
+        Close();
+#ifdef _WIN32
+        file = CreateFileA(path,
+                           GENERIC_READ,
+                           FILE_SHARE_READ,
+                           nullptr,
+                           OPEN_EXISTING,
+                           FILE_FLAG_SEQUENTIAL_SCAN,
+                           nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER length;
+        if (!GetFileSizeEx(file, &length) || length.QuadPart == 0) {
+            Close();
+            return false;
+        }
+        mapping =
+          CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) {
+            Close();
+            return false;
+        }
+        data = (const Uint8*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        size = (size_t)length.QuadPart;
+#else
+        int fd = open(path, O_RDONLY);
+        if (fd < 0)
+            return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            close(fd);
+            return false;
+        }
+        void* view = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd); // the mapping keeps the file alive
+        if (view == MAP_FAILED)
+            return false;
+        data = (const Uint8*)view;
+        size = (size_t)st.st_size;
+#endif
+        if (!data) {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void Close()
+    {
+#ifdef _WIN32
+        if (data)
+            UnmapViewOfFile(data);
+        if (mapping)
+            CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE)
+            CloseHandle(file);
+        mapping = nullptr;
+        file = INVALID_HANDLE_VALUE;
+#else
+        if (data)
+            munmap((void*)data, size);
+#endif
+        data = nullptr;
+        size = 0;
+    }
+
+    const Uint8* Data() const { return data; }
+    size_t Size() const { return size; }
+};
+
+// Indexed triangle mesh. Vertices and indices either live in owned vectors
+// (built in code or parsed from OBJ) or point straight into a memory-mapped
+// binary file, so loading a baked mesh copies nothing.
+//
+// Binary layout (little endian), see MeshHeader: header, then the vertex
+// array at vertexOffset and the Uint32 index array at indexOffset, both
+// 16-byte aligned.
+class Mesh
+{
+  public:
+    struct MeshHeader
+    {
+        char magic[8]; // "SCMESH1"
+        Uint64 vertexCount;
+        Uint64 indexCount;
+        Uint64 vertexOffset;
+        Uint64 indexOffset;
+        float boundsMin[3];
+        float boundsMax[3];
+    };
+
+  private:
+    static constexpr char magic[8] = "SCMESH1";
+
+    std::vector<Vertex> ownedVertices;
+    std::vector<Uint32> ownedIndices;
+    MappedFile mapped;
+
+    const Vertex* vertices = nullptr;
+    const Uint32* indices = nullptr;
+    size_t vertexCount = 0, indexCount = 0;
+    glm::vec3 boundsMin{ 0.0f }, boundsMax{ 0.0f };
+
+    void UseOwned()
+    {
+        mapped.Close();
+        vertices = ownedVertices.data();
+        indices = ownedIndices.data();
+        vertexCount = ownedVertices.size();
+        indexCount = ownedIndices.size();
+    }
+
+    void ComputeBounds()
+    {
+        boundsMin = boundsMax = glm::vec3(0.0f);
+        if (vertexCount == 0)
+            return;
+        boundsMin = boundsMax = vertices[0].position;
+        for (size_t i = 1; i < vertexCount; i++) {
+            boundsMin = glm::min(boundsMin, vertices[i].position);
+            boundsMax = glm::max(boundsMax, vertices[i].position);
+        }
+    }
+
+    static const char* SkipSpaces(const char* p, const char* end)
+    {
+        while (p < end && (*p == ' ' || *p == '\t'))
+            p++;
+        return p;
+    }
+
+    static const char* ParseFloat(const char* p, const char* end, float& out)
+    {
+        p = SkipSpaces(p, end);
+        if (p < end && *p == '+')
+            p++;
+        auto result = std::from_chars(p, end, out);
+        return result.ec == std::errc() ? result.ptr : nullptr;
+    }
+
+  public:
+    Mesh() = default;
+    Mesh(const Mesh&) = delete;
+    Mesh& operator=(const Mesh&) = delete;
+
+    void Assign(std::vector<Vertex> v, std::vector<Uint32> i)
+    {
+        ownedVertices = std::move(v);
+        ownedIndices = std::move(i);
+        UseOwned();
+        ComputeBounds();
+    }
+
+    // Wavefront OBJ: positions (with the common "v x y z r g b" color
+    // extension), faces of any size in v, v/vt, v//vn or v/vt/vn form with
+    // negative indices, fan-triangulated. Texture coordinates and normals are
+    // ignored; vertices without a color get one from their position.
+    bool LoadOBJ(const char* path)
+    {
+        MappedFile file;
+        if (!file.Open(path)) {
+            SDL_Log("Couldn't open %s", path);
+            return false;
+        }
+
+        std::vector<Vertex> v;
+        std::vector<Uint32> idx;
+        std::vector<bool> hasColor;
+        Uint32 face[64];
+
+        const char* p = (const char*)file.Data();
+        const char* end = p + file.Size();
+        size_t lineNumber = 0;
+        while (p < end) {
+            const char* eol = (const char*)memchr(p, '\n', end - p);
+            if (!eol)
+                eol = end;
+            lineNumber++;
+            const char* q = SkipSpaces(p, eol);
+
+            if (eol - q > 2 && q[0] == 'v' && (q[1] == ' ' || q[1] == '\t')) {
+                Vertex vertex;
+                q += 2;
+                for (int k = 0; k < 3 && q; k++)
+                    q = ParseFloat(q, eol, vertex.position[k]);
+                if (!q) {
+                    SDL_Log("%s:%zu: bad vertex", path, lineNumber);
+                    return false;
+                }
+                const char* c = q;
+                for (int k = 0; k < 3 && c; k++)
+                    c = ParseFloat(c, eol, vertex.color[k]);
+                hasColor.push_back(c != nullptr);
+                v.push_back(vertex);
+            } else if (eol - q > 2 && q[0] == 'f' &&
+                       (q[1] == ' ' || q[1] == '\t')) {
+                int count = 0;
+                q += 2;
+                for (;;) {
+                    q = SkipSpaces(q, eol);
+                    if (q >= eol || *q == '\r' || *q == '#')
+                        break;
+                    long long value = 0;
+                    auto result = std::from_chars(q, eol, value);
+                    if (result.ec != std::errc() || value == 0) {
+                        SDL_Log("%s:%zu: bad face", path, lineNumber);
+                        return false;
+                    }
+                    // Skip /vt/vn
+                    q = result.ptr;
+                    while (q < eol && *q != ' ' && *q != '\t' && *q != '\r')
+                        q++;
+
+                    long long index =
+                      value < 0 ? (long long)v.size() + value : value - 1;
+                    if (index < 0 || index >= (long long)v.size()) {
+                        SDL_Log("%s:%zu: index out of range", path, lineNumber);
+                        return false;
+                    }
+                    if (count < (int)SDL_arraysize(face))
+                        face[count++] = (Uint32)index;
+                }
+                for (int k = 1; k + 1 < count; k++)
+                    idx.insert(idx.end(), { face[0], face[k], face[k + 1] });
+            }
+            p = eol + 1;
+        }
+
+        Assign(std::move(v), std::move(idx));
+
+        // Tô màu theo vị trí cho các đỉnh không có màu
+        glm::vec3 extent = boundsMax - boundsMin;
+        for (size_t i = 0; i < ownedVertices.size(); i++) {
+            if (hasColor[i])
+                continue;
+            glm::vec3 t = ownedVertices[i].position - boundsMin;
+            ownedVertices[i].color =
+              glm::vec3(extent.x > 0 ? t.x / extent.x : 0.5f,
+                        extent.y > 0 ? t.y / extent.y : 0.5f,
+                        extent.z > 0 ? t.z / extent.z : 0.5f);
+        }
+        return true;
+    }
+
+    // Map a baked file; vertex and index arrays point into the mapping.
+    // The header is checked against the file size without overflowing and
+    // every index against the vertex count, so a corrupt or hostile file is
+    // rejected here instead of read out of bounds later. That pass touches
+    // the index pages once; the vertex pages are read right after loading
+    // anyway (cube copies every position out).
+    bool LoadBinary(const char* path)
+    {
+        if (!mapped.Open(path)) {
+            SDL_Log("Couldn't map %s", path);
+            return false;
+        }
+
+        MeshHeader header;
+        if (mapped.Size() < sizeof(header)) {
+            SDL_Log("%s: truncated header", path);
+            mapped.Close();
+            return false;
+        }
+        memcpy(&header, mapped.Data(), sizeof(header));
+
+        // count * size > size - offset, written so that nothing can wrap
+        const Uint64 size = mapped.Size();
+        auto fits = [size](Uint64 offset, Uint64 count, Uint64 itemSize) {
+            return offset <= size && count <= (size - offset) / itemSize;
+        };
+        if (memcmp(header.magic, magic, sizeof(magic)) != 0 ||
+            header.vertexOffset % 16 || header.indexOffset % 16 ||
+            !fits(header.vertexOffset, header.vertexCount, sizeof(Vertex)) ||
+            !fits(header.indexOffset, header.indexCount, sizeof(Uint32))) {
+            SDL_Log("%s: not a baked mesh", path);
+            mapped.Close();
+            return false;
+        }
+        // Index là Uint32, và phải đủ bộ ba cho từng tam giác
+        if (header.vertexCount > 0xFFFFFFFFull || header.indexCount % 3) {
+            SDL_Log("%s: bad vertex or index count", path);
+            mapped.Close();
+            return false;
+        }
+
+        const Uint32* mappedIndices =
+          (const Uint32*)(mapped.Data() + header.indexOffset);
+        Uint32 maxIndex = 0;
+        for (Uint64 i = 0; i < header.indexCount; i++)
+            maxIndex = SDL_max(maxIndex, mappedIndices[i]);
+        if (header.indexCount > 0 && maxIndex >= header.vertexCount) {
+            SDL_Log("%s: index %u out of range (%llu vertices)",
+                    path,
+                    maxIndex,
+                    (unsigned long long)header.vertexCount);
+            mapped.Close();
+            return false;
+        }
+
+        ownedVertices.clear();
+        ownedIndices.clear();
+        vertices = (const Vertex*)(mapped.Data() + header.vertexOffset);
+        indices = mappedIndices;
+        vertexCount = header.vertexCount;
+        indexCount = header.indexCount;
+        boundsMin = glm::vec3(
+          header.boundsMin[0], header.boundsMin[1], header.boundsMin[2]);
+        boundsMax = glm::vec3(
+          header.boundsMax[0], header.boundsMax[1], header.boundsMax[2]);
+        return true;
+    }
+
+    // Pick the loader from the extension: ".obj" is parsed, anything else is
+    // treated as a baked binary mesh
+    bool Load(const char* path)
+    {
+        size_t length = strlen(path);
+        if (length >= 4 && SDL_strcasecmp(path + length - 4, ".obj") == 0)
+            return LoadOBJ(path);
+        return LoadBinary(path);
+    }
+
+    bool SaveBinary(const char* path) const
+    {
+        MeshHeader header = {};
+        memcpy(header.magic, magic, sizeof(magic));
+        header.vertexCount = vertexCount;
+        header.indexCount = indexCount;
+        header.vertexOffset = (sizeof(header) + 15) & ~(Uint64)15;
+        header.indexOffset =
+          (header.vertexOffset + vertexCount * sizeof(Vertex) + 15) &
+          ~(Uint64)15;
+        for (int k = 0; k < 3; k++) {
+            header.boundsMin[k] = boundsMin[k];
+            header.boundsMax[k] = boundsMax[k];
+        }
+
+        SDL_IOStream* io = SDL_IOFromFile(path, "wb");
+        if (!io) {
+            SDL_Log("Couldn't create %s: %s", path, SDL_GetError());
+            return false;
+        }
+
+        static const Uint8 zeros[16] = {};
+        bool ok = SDL_WriteIO(io, &header, sizeof(header)) == sizeof(header);
+        ok = ok && SDL_WriteIO(io,
+                               zeros,
+                               header.vertexOffset - sizeof(header)) ==
+                     header.vertexOffset - sizeof(header);
+        size_t vertexBytes = vertexCount * sizeof(Vertex);
+        ok = ok && SDL_WriteIO(io, vertices, vertexBytes) == vertexBytes;
+        size_t pad = header.indexOffset - header.vertexOffset - vertexBytes;
+        ok = ok && SDL_WriteIO(io, zeros, pad) == pad;
+        size_t indexBytes = indexCount * sizeof(Uint32);
+        ok = ok && SDL_WriteIO(io, indices, indexBytes) == indexBytes;
+        ok = SDL_CloseIO(io) && ok;
+        if (!ok)
+            SDL_Log("Couldn't write %s: %s", path, SDL_GetError());
+        return ok;
+    }
+
+    const Vertex* Vertices() const { return vertices; }
+    const Uint32* Indices() const { return indices; }
+    size_t VertexCount() const { return vertexCount; }
+    size_t IndexCount() const { return indexCount; }
+    size_t TriangleCount() const { return indexCount / 3; }
+    glm::vec3 BoundsMin() const { return boundsMin; }
+    glm::vec3 BoundsMax() const { return boundsMax; }
+};
+
+// UV sphere of radius 0.5 colored by position; 2 * stacks * slices triangles
+inline void
+MakeSphere(int stacks,
+           int slices,
+           std::vector<Vertex>& vertices,
+           std::vector<Uint32>& indices)
+{
+    vertices.clear();
+    indices.clear();
+    for (int i = 0; i <= stacks; i++) {
+        for (int j = 0; j <= slices; j++) {
+            float phi = SDL_PI_F * i / stacks;
+            float theta = 2.0f * SDL_PI_F * j / slices;
+            glm::vec3 p(SDL_sinf(phi) * SDL_cosf(theta),
+                        SDL_cosf(phi),
+                        SDL_sinf(phi) * SDL_sinf(theta));
+            vertices.push_back({ p * 0.5f, p * 0.5f + 0.5f });
+        }
+    }
+
+    Uint32 row = slices + 1;
+    for (int i = 0; i < stacks; i++) {
+        for (int j = 0; j < slices; j++) {
+            Uint32 a = i * row + j, b = (i + 1) * row + j;
+            Uint32 c = b + 1, d = a + 1;
+            indices.insert(indices.end(), { a, b, c, c, d, a });
+        }
+    }
+}
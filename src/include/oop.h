@@ -1,29 +1,761 @@
-#include <SDL3/SDL_events.h>
-#include <SDL3/SDL_rect.h>
-#include <SDL3/SDL_render.h>
-#include <SDL3/SDL_surface.h>
+#pragma once
+#include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include "glyph_cache.h"
+#include "progress_bar.h"
+#include "sprite_batch.h"
+#include "text_layout.h"
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
-class Button {
-private:
-SDL_FRect button;
+// Small widget toolkit. Widgets are retained objects owned by a Ui, which
+// routes mouse events to them, but they are drawn from scratch every frame
+// (immediate style) through a UiPainter: rectangles and text are all quads
+// of one glyph atlas, so a whole UI is one SpriteBatch flush, i.e. one
+// SDL_RenderGeometry call however many widgets there are.
 
-public:
+// Flat rectangles (the atlas' white patch, tinted) and text. An optional
+// clip rectangle crops quads on the CPU, so clipping needs no extra draw.
+class UiPainter
+{
+  private:
+    SpriteBatch& batch;
+    GlyphCache& glyphs;
+    TextLayout& layout;
+    TTF_Font* font;
+    std::vector<GlyphQuad> quads;
+    SDL_FRect clip = {};
+    bool clipping = false;
+
+    void quad(SDL_Texture* t, SDL_FRect dst, SDL_FRect src, SDL_FColor color)
+    {
+        if (clipping) {
+            float x0 = SDL_max(dst.x, clip.x);
+            float y0 = SDL_max(dst.y, clip.y);
+            float x1 = SDL_min(dst.x + dst.w, clip.x + clip.w);
+            float y1 = SDL_min(dst.y + dst.h, clip.y + clip.h);
+            if (x1 <= x0 || y1 <= y0)
+                return;
+            // Cắt src theo cùng tỉ lệ với dst
+            float sx = src.w / dst.w, sy = src.h / dst.h;
+            src = { src.x + (x0 - dst.x) * sx,
+                    src.y + (y0 - dst.y) * sy,
+                    (x1 - x0) * sx,
+                    (y1 - y0) * sy };
+            dst = { x0, y0, x1 - x0, y1 - y0 };
+        }
+        batch.draw(t, dst, 0.0f, color, &src);
+    }
+
+  public:
+    // `font` may be null; text is then skipped
+    UiPainter(SpriteBatch& b, GlyphCache& g, TextLayout& l, TTF_Font* f)
+      : batch(b)
+      , glyphs(g)
+      , layout(l)
+      , font(f)
+    {
+    }
+
+    TTF_Font* getFont() const { return font; }
+
+    // Crop everything drawn after this to `rect`; null turns it off
+    void setClip(const SDL_FRect* rect)
+    {
+        clipping = rect != nullptr;
+        if (rect)
+            clip = *rect;
+    }
+
+    void fill(const SDL_FRect& rect, SDL_FColor color)
+    {
+        SDL_Texture* texture;
+        SDL_FRect src;
+        if (glyphs.getSolid(texture, src))
+            quad(texture, rect, src, color);
+    }
+
+    // Outline `width` pixels thick, inside `rect`
+    void stroke(const SDL_FRect& rect, SDL_FColor color, float width = 1.0f)
+    {
+        fill({ rect.x, rect.y, rect.w, width }, color);
+        fill({ rect.x, rect.y + rect.h - width, rect.w, width }, color);
+        fill({ rect.x, rect.y + width, width, rect.h - 2 * width }, color);
+        fill({ rect.x + rect.w - width,
+               rect.y + width,
+               width,
+               rect.h - 2 * width },
+             color);
+    }
+
+    // Shape one line of text into `out` for the text() overload below, so
+    // text that does not change can skip shaping on later frames
+    SDL_FPoint shape(const char* s, std::vector<GlyphQuad>& out)
+    {
+        out.clear();
+        if (!font || !*s)
+            return { 0.0f, 0.0f };
+        return layout.shape(font, s, out);
+    }
+
+    // One line of text vertically centered in `box`
+    void text(const char* s,
+              const SDL_FRect& box,
+              SDL_FColor color,
+              TextLayout::Align align = TextLayout::Left)
+    {
+        SDL_FPoint size = shape(s, quads);
+        text(quads, size, box, color, align);
+    }
+
+    // Same with quads and size from shape()
+    void text(const std::vector<GlyphQuad>& shaped,
+              SDL_FPoint size,
+              const SDL_FRect& box,
+              SDL_FColor color,
+              TextLayout::Align align = TextLayout::Left)
+    {
+        if (shaped.empty())
+            return;
+        float x = box.x;
+        if (align == TextLayout::Center)
+            x += (box.w - size.x) * 0.5f;
+        else if (align == TextLayout::Right)
+            x += box.w - size.x;
+        x = SDL_floorf(x);
+        float y = SDL_floorf(box.y + (box.h - size.y) * 0.5f);
+        for (const GlyphQuad& q : shaped)
+            quad(q.texture,
+                 { q.dst.x + x, q.dst.y + y, q.dst.w, q.dst.h },
+                 q.src,
+                 color);
+    }
+};
+
+class Ui;
+
+class Widget
+{
+  protected:
+    Ui* ui = nullptr;
+    SDL_FRect bounds = {};
+    bool hovered = false;
+    bool pressed = false;
+
+    friend class Ui;
+
+  public:
+    Widget() = default;
+    explicit Widget(const SDL_FRect& r)
+      : bounds(r)
+    {
+    }
+    virtual ~Widget() = default;
+
+    const SDL_FRect& getBounds() const { return bounds; }
+    void setBounds(const SDL_FRect& r); // after Ui
+
+    bool contains(float x, float y) const
+    {
+        return x >= bounds.x && y >= bounds.y && x < bounds.x + bounds.w &&
+               y < bounds.y + bounds.h;
+    }
+
+    bool isHovered() const { return hovered; }
+    bool isPressed() const { return pressed; }
+
+    // Only interactive widgets are hit-tested; the rest let the mouse through
+    virtual bool isInteractive() const { return false; }
+
+    virtual void draw(UiPainter& painter) = 0;
+
+    // Press and release both inside the widget
+    virtual void onClick(float x, float y) {}
+    // Returns whether the wheel was used
+    virtual bool onWheel(float x, float y, float dy) { return false; }
+};
+
+class Label : public Widget
+{
+  private:
+    std::string text;
+    SDL_FColor color;
+    TextLayout::Align align;
+
+  public:
+    Label(const SDL_FRect& r,
+          std::string t,
+          SDL_FColor c = SpriteBatch::white,
+          TextLayout::Align a = TextLayout::Left)
+      : Widget(r)
+      , text(std::move(t))
+      , color(c)
+      , align(a)
+    {
+    }
+
+    const std::string& getText() const { return text; }
+    void setText(const char* t) { text = t; }
+
+    void draw(UiPainter& painter) override
+    {
+        painter.text(text.c_str(), bounds, color, align);
+    }
+};
+
+class Button : public Widget
+{
+  private:
+    std::string text;
+    std::function<void(Button&)> clicked;
+
+  public:
     Button() = default;
-    ~Button() = default;
 
-    Button(int x, int y, int w, int h) {
-        this->button.x = x;
-        this->button.y = y;
-        this->button.w = w;
-        this->button.h = h;
+    Button(int x, int y, int w, int h)
+      : Widget({ (float)x, (float)y, (float)w, (float)h })
+    {
+    }
+
+    Button(const SDL_FRect& r,
+           std::string t,
+           std::function<void(Button&)> onClicked = nullptr)
+      : Widget(r)
+      , text(std::move(t))
+      , clicked(std::move(onClicked))
+    {
+    }
+
+    const std::string& getText() const { return text; }
+    void setText(const char* t) { text = t; }
+    void setOnClick(std::function<void(Button&)> f) { clicked = std::move(f); }
+
+    bool isInteractive() const override { return true; }
+
+    void draw(UiPainter& painter) override
+    {
+        float shade = pressed ? 0.10f : hovered ? 0.30f : 0.18f;
+        painter.fill(bounds, { shade, shade, shade, 1.0f });
+        painter.stroke(bounds, SpriteBatch::white);
+        painter.text(
+          text.c_str(), bounds, SpriteBatch::white, TextLayout::Center);
+    }
+
+    void onClick(float x, float y) override
+    {
+        if (clicked)
+            clicked(*this);
+    }
+};
+
+// Progress bar with a second value running ahead of the first, e.g.
+// decoded vs. done. Parts and colors come from progress_bar.h.
+class ProgressBar : public Widget
+{
+  private:
+    float value = 0.0f;
+    float ahead = 0.0f;
+
+  public:
+    explicit ProgressBar(const SDL_FRect& r)
+      : Widget(r)
+    {
+    }
+
+    float getValue() const { return value; }
+    void setValue(float done, float decoded = 0.0f)
+    {
+        value = SDL_clamp(done, 0.0f, 1.0f);
+        ahead = SDL_clamp(decoded, 0.0f, 1.0f);
+    }
+
+    void draw(UiPainter& painter) override
+    {
+        painter.stroke(bounds, ProgressBarParts::outline);
+        painter.fill(ProgressBarParts::fill(bounds, ahead),
+                     ProgressBarParts::ahead);
+        painter.fill(ProgressBarParts::fill(bounds, value),
+                     ProgressBarParts::done);
+    }
+};
+
+// Scrollable list of text rows with one selected row. Only the visible
+// rows are drawn, cropped to the list.
+class List : public Widget
+{
+  private:
+    std::vector<std::string> items;
+    float rowHeight;
+    float scroll = 0.0f; // pixels
+    int selected = -1;
+    std::function<void(List&, int)> selectedChanged;
+
+    float maxScroll() const
+    {
+        return SDL_max(0.0f, items.size() * rowHeight - bounds.h);
+    }
+
+  public:
+    List(const SDL_FRect& r, float row)
+      : Widget(r)
+      , rowHeight(row)
+    {
+    }
+
+    void add(std::string item) { items.push_back(std::move(item)); }
+    void clear()
+    {
+        items.clear();
+        selected = -1;
+        scroll = 0.0f;
+    }
+    int getCount() const { return (int)items.size(); }
+    const std::string& getItem(int i) const { return items[i]; }
+    int getSelected() const { return selected; }
+    void setOnSelect(std::function<void(List&, int)> f)
+    {
+        selectedChanged = std::move(f);
+    }
+
+    bool isInteractive() const override { return true; }
+
+    void draw(UiPainter& painter) override
+    {
+        painter.fill(bounds, { 0.12f, 0.12f, 0.12f, 1.0f });
+        painter.setClip(&bounds);
+        int first = (int)(scroll / rowHeight);
+        int last = (int)((scroll + bounds.h) / rowHeight);
+        for (int i = first; i <= last && i < (int)items.size(); i++) {
+            SDL_FRect row = { bounds.x,
+                              bounds.y + i * rowHeight - scroll,
+                              bounds.w,
+                              rowHeight };
+            if (i == selected)
+                painter.fill(row, { 0.25f, 0.35f, 0.6f, 1.0f });
+            SDL_FRect text = { row.x + 6, row.y, row.w - 12, row.h };
+            painter.text(items[i].c_str(), text, SpriteBatch::white);
+        }
+        painter.setClip(nullptr);
+        painter.stroke(bounds, SpriteBatch::white);
+    }
+
+    void onClick(float x, float y) override
+    {
+        int row = (int)((y - bounds.y + scroll) / rowHeight);
+        if (row < 0 || row >= (int)items.size() || row == selected)
+            return;
+        selected = row;
+        if (selectedChanged)
+            selectedChanged(*this, row);
+    }
+
+    bool onWheel(float x, float y, float dy) override
+    {
+        scroll = SDL_clamp(scroll - dy * rowHeight * 3, 0.0f, maxScroll());
+        return true;
+    }
+};
+
+// List over an item source instead of stored strings, for hundreds of
+// thousands of rows. Only the rows in view exist: a pool of one row per
+// visible slot, each keeping its item's text and shaped glyph quads. A row
+// that scrolls out is reused for the item scrolling in, so a frame fetches
+// and shapes only newly exposed items and costs the same for any count.
+// Call refresh() when items change or the glyph cache is cleared.
+class VirtualList : public Widget
+{
+  public:
+    // Writes the text of item `index` into `out` (empty on entry)
+    using Source = std::function<void(int index, std::string& out)>;
+
+  private:
+    struct Row
+    {
+        int index = -1; // item shown, -1 when none
+        std::string text;
+        std::vector<GlyphQuad> quads;
+        SDL_FPoint size = {};
+    };
+
+    Source source;
+    int count;
+    float rowHeight;
+    // Pixels; double because count * rowHeight outgrows float precision
+    double scroll = 0.0;
+    int selected = -1;
+    std::vector<Row> pool; // item i lives in pool[i % pool.size()]
+    std::function<void(VirtualList&, int)> selectedChanged;
+    Uint64 rowsBuilt = 0;
+
+    static constexpr float scrollbarWidth = 8.0f;
+
+    double maxScroll() const
+    {
+        return SDL_max(0.0, count * (double)rowHeight - bounds.h);
+    }
+
+    Row& row(UiPainter& painter, int index)
+    {
+        Row& r = pool[index % pool.size()];
+        if (r.index != index) {
+            // Tái sử dụng hàng cũ: chuỗi và vector giữ nguyên bộ nhớ
+            r.index = index;
+            r.text.clear();
+            source(index, r.text);
+            r.size = painter.shape(r.text.c_str(), r.quads);
+            rowsBuilt++;
+        }
+        return r;
+    }
+
+  public:
+    VirtualList(const SDL_FRect& r, float row, int n, Source s)
+      : Widget(r)
+      , source(std::move(s))
+      , count(SDL_max(0, n))
+      , rowHeight(row)
+    {
+    }
+
+    int getCount() const { return count; }
+    // Keeps the scroll position and selection where they are still valid
+    void setCount(int n)
+    {
+        count = SDL_max(0, n);
+        if (selected >= count)
+            selected = -1;
+        scroll = SDL_min(scroll, maxScroll());
+        refresh();
+    }
+
+    // Fetch and shape every row again on the next draw
+    void refresh()
+    {
+        for (Row& r : pool)
+            r.index = -1;
+    }
+
+    int getSelected() const { return selected; }
+    void setOnSelect(std::function<void(VirtualList&, int)> f)
+    {
+        selectedChanged = std::move(f);
+    }
+
+    // Scroll just enough to bring item `index` into view
+    void scrollTo(int index)
+    {
+        double top = index * (double)rowHeight;
+        if (top < scroll)
+            scroll = top;
+        else if (top + rowHeight > scroll + bounds.h)
+            scroll = top + rowHeight - bounds.h;
+        scroll = SDL_clamp(scroll, 0.0, maxScroll());
+    }
+
+    // Rows fetched and shaped so far
+    Uint64 getRowsBuilt() const { return rowsBuilt; }
+    int getPoolSize() const { return (int)pool.size(); }
+
+    bool isInteractive() const override { return true; }
+
+    void draw(UiPainter& painter) override
+    {
+        painter.fill(bounds, { 0.12f, 0.12f, 0.12f, 1.0f });
+        // Một hàng cho mỗi vị trí nhìn thấy, cộng một khi cuộn lệch hàng
+        size_t slots = (size_t)SDL_ceilf(bounds.h / rowHeight) + 1;
+        if (pool.size() != slots)
+            pool.resize(slots);
+
+        if (count > 0 && source) {
+            const float textWidth = bounds.w - 12 - scrollbarWidth;
+            int first = (int)(scroll / rowHeight);
+            int last = (int)((scroll + bounds.h) / rowHeight);
+            last = SDL_min(last, count - 1);
+            painter.setClip(&bounds);
+            for (int i = first; i <= last; i++) {
+                SDL_FRect rect = { bounds.x,
+                                   bounds.y +
+                                     (float)(i * (double)rowHeight - scroll),
+                                   bounds.w,
+                                   rowHeight };
+                if (i == selected)
+                    painter.fill(rect, { 0.25f, 0.35f, 0.6f, 1.0f });
+                Row& r = row(painter, i);
+                painter.text(r.quads,
+                             r.size,
+                             { rect.x + 6, rect.y, textWidth, rect.h },
+                             SpriteBatch::white);
+            }
+
+            double total = count * (double)rowHeight;
+            if (total > bounds.h) {
+                float h = SDL_max(16.0f, (float)(bounds.h / total) * bounds.h);
+                float y = (float)(scroll / maxScroll()) * (bounds.h - h);
+                painter.fill({ bounds.x + bounds.w - scrollbarWidth,
+                               bounds.y + y,
+                               scrollbarWidth,
+                               h },
+                             { 0.5f, 0.5f, 0.5f, 1.0f });
+            }
+            painter.setClip(nullptr);
+        }
+        painter.stroke(bounds, SpriteBatch::white);
+    }
+
+    // A click on the scroll bar jumps there; elsewhere it selects a row
+    void onClick(float x, float y) override
+    {
+        if (x >= bounds.x + bounds.w - scrollbarWidth) {
+            float t = SDL_clamp((y - bounds.y) / bounds.h, 0.0f, 1.0f);
+            scroll = t * maxScroll();
+            return;
+        }
+        double at = (y - bounds.y) + scroll;
+        int index = (int)(at / rowHeight);
+        if (index < 0 || index >= count || index == selected)
+            return;
+        selected = index;
+        if (selectedChanged)
+            selectedChanged(*this, index);
+    }
+
+    bool onWheel(float x, float y, float dy) override
+    {
+        scroll = SDL_clamp(scroll - dy * rowHeight * 3, 0.0, maxScroll());
+        return true;
+    }
+};
+
+// Owns the widgets, dispatches mouse events and draws them in the order
+// they were added (later ones on top). Hit-testing goes through a uniform
+// grid of the interactive widgets: each cell lists the widgets overlapping
+// it, so an event only checks the few in its cell instead of all of them.
+// The grid is rebuilt lazily after widgets are added or moved; by default
+// its cells are twice the average size of the widgets in it.
+class Ui
+{
+  private:
+    std::vector<std::unique_ptr<Widget>> widgets;
+
+    float fixedCellSize;
+    float cellSize = 64.0f;
+    SDL_FRect area = {}; // covered by the grid
+    int columns = 0, rows = 0;
+    std::vector<int> cellStart; // columns * rows + 1 offsets into cellItems
+    std::vector<int> cellItems; // widget indices, ascending within a cell
+    bool gridDirty = true;
+
+    Widget* hovered = nullptr;
+    Widget* pressed = nullptr;
+
+    Uint64 hitTests = 0, candidates = 0;
+
+    void cellRange(const SDL_FRect& r, int& x0, int& y0, int& x1, int& y1)
+    {
+        x0 = SDL_clamp((int)((r.x - area.x) / cellSize), 0, columns - 1);
+        y0 = SDL_clamp((int)((r.y - area.y) / cellSize), 0, rows - 1);
+        x1 = SDL_clamp((int)((r.x + r.w - area.x) / cellSize), 0, columns - 1);
+        y1 = SDL_clamp((int)((r.y + r.h - area.y) / cellSize), 0, rows - 1);
+    }
+
+    void rebuildGrid()
+    {
+        gridDirty = false;
+        bool any = false;
+        for (const auto& w : widgets) {
+            if (!w->isInteractive())
+                continue;
+            const SDL_FRect& b = w->bounds;
+            if (!any) {
+                area = b;
+                any = true;
+            } else {
+                float x1 = SDL_max(area.x + area.w, b.x + b.w);
+                float y1 = SDL_max(area.y + area.h, b.y + b.h);
+                area.x = SDL_min(area.x, b.x);
+                area.y = SDL_min(area.y, b.y);
+                area.w = x1 - area.x;
+                area.h = y1 - area.y;
+            }
+        }
+
+        // Ô lưới gấp đôi kích thước trung bình: mỗi widget chạm ít ô, mỗi ô
+        // chứa ít widget
+        cellSize = fixedCellSize;
+        if (cellSize <= 0.0f) {
+            double sum = 0.0;
+            int interactive = 0;
+            for (const auto& w : widgets)
+                if (w->isInteractive()) {
+                    sum += SDL_max(w->bounds.w, w->bounds.h);
+                    interactive++;
+                }
+            cellSize = interactive ? (float)(2.0 * sum / interactive) : 64.0f;
+            cellSize = SDL_clamp(cellSize, 8.0f, 512.0f);
+        }
+        columns = any ? SDL_max(1, (int)SDL_ceilf(area.w / cellSize)) : 0;
+        rows = any ? SDL_max(1, (int)SDL_ceilf(area.h / cellSize)) : 0;
+
+        // Đếm trước rồi xếp, mỗi ô là một đoạn liên tục trong cellItems
+        cellStart.assign((size_t)columns * rows + 1, 0);
+        int x0, y0, x1, y1;
+        for (const auto& w : widgets) {
+            if (!w->isInteractive())
+                continue;
+            cellRange(w->bounds, x0, y0, x1, y1);
+            for (int y = y0; y <= y1; y++)
+                for (int x = x0; x <= x1; x++)
+                    cellStart[y * columns + x + 1]++;
+        }
+        for (size_t i = 1; i < cellStart.size(); i++)
+            cellStart[i] += cellStart[i - 1];
+        cellItems.resize(cellStart.back());
+        std::vector<int> fill(cellStart.begin(), cellStart.end() - 1);
+        for (int i = 0; i < (int)widgets.size(); i++) {
+            if (!widgets[i]->isInteractive())
+                continue;
+            cellRange(widgets[i]->bounds, x0, y0, x1, y1);
+            for (int y = y0; y <= y1; y++)
+                for (int x = x0; x <= x1; x++)
+                    cellItems[fill[y * columns + x]++] = i;
+        }
     }
 
-    void draw(SDL_Renderer * render) {
-        SDL_SetRenderDrawColor(render, 255, 255, 255, 255);
-        SDL_RenderRect(render, &this->button);
+  public:
+    // `cellSize` in pixels, 0 to derive it from the widgets
+    explicit Ui(float cellSize = 0.0f)
+      : fixedCellSize(cellSize)
+    {
     }
 
-    void handle(SDL_Event * event) {
-        // if(event->type == )
+    Ui(const Ui&) = delete;
+    Ui& operator=(const Ui&) = delete;
+
+    template<class T, class... Args>
+    T& add(Args&&... args)
+    {
+        auto widget = std::make_unique<T>(std::forward<Args>(args)...);
+        T& ref = *widget;
+        ref.ui = this;
+        widgets.push_back(std::move(widget));
+        gridDirty = true;
+        return ref;
+    }
+
+    void clear()
+    {
+        widgets.clear();
+        hovered = pressed = nullptr;
+        gridDirty = true;
+    }
+
+    void invalidateGrid() { gridDirty = true; }
+
+    // Topmost interactive widget under (x, y), or null
+    Widget* hitTest(float x, float y)
+    {
+        if (gridDirty)
+            rebuildGrid();
+        hitTests++;
+        if (columns == 0 || x < area.x || y < area.y ||
+            x >= area.x + area.w || y >= area.y + area.h)
+            return nullptr;
+        int cx = SDL_min((int)((x - area.x) / cellSize), columns - 1);
+        int cy = SDL_min((int)((y - area.y) / cellSize), rows - 1);
+        int cell = cy * columns + cx;
+        for (int i = cellStart[cell + 1] - 1; i >= cellStart[cell]; i--) {
+            candidates++;
+            Widget* w = widgets[cellItems[i]].get();
+            if (w->contains(x, y))
+                return w;
+        }
+        return nullptr;
+    }
+
+    // Same answer as hitTest() by checking every widget, for comparison
+    Widget* hitTestLinear(float x, float y)
+    {
+        hitTests++;
+        for (int i = (int)widgets.size() - 1; i >= 0; i--) {
+            candidates++;
+            Widget* w = widgets[i].get();
+            if (w->isInteractive() && w->contains(x, y))
+                return w;
+        }
+        return nullptr;
     }
-};
\ No newline at end of file
+
+    // Returns whether a widget used the event
+    bool handleEvent(const SDL_Event* event)
+    {
+        switch (event->type) {
+            case SDL_EVENT_MOUSE_MOTION: {
+                Widget* hit = hitTest(event->motion.x, event->motion.y);
+                if (hit != hovered) {
+                    if (hovered)
+                        hovered->hovered = false;
+                    if (hit)
+                        hit->hovered = true;
+                    hovered = hit;
+                }
+                return hit != nullptr;
+            }
+            case SDL_EVENT_MOUSE_BUTTON_DOWN: {
+                if (event->button.button != SDL_BUTTON_LEFT)
+                    return false;
+                pressed = hitTest(event->button.x, event->button.y);
+                if (pressed)
+                    pressed->pressed = true;
+                return pressed != nullptr;
+            }
+            case SDL_EVENT_MOUSE_BUTTON_UP: {
+                if (event->button.button != SDL_BUTTON_LEFT || !pressed)
+                    return false;
+                // Nhả chuột trên đúng widget đã nhấn mới tính là click
+                Widget* target = pressed;
+                pressed->pressed = false;
+                pressed = nullptr;
+                if (hitTest(event->button.x, event->button.y) == target)
+                    target->onClick(event->button.x, event->button.y);
+                return true;
+            }
+            case SDL_EVENT_MOUSE_WHEEL: {
+                Widget* hit =
+                  hitTest(event->wheel.mouse_x, event->wheel.mouse_y);
+                return hit && hit->onWheel(event->wheel.mouse_x,
+                                           event->wheel.mouse_y,
+                                           event->wheel.y);
+            }
+            default:
+                return false;
+        }
+    }
+
+    // Queue every widget on the painter's batch; the caller flushes it
+    void draw(UiPainter& painter)
+    {
+        for (const auto& w : widgets)
+            w->draw(painter);
+    }
+
+    int getWidgetCount() const { return (int)widgets.size(); }
+    Uint64 getHitTests() const { return hitTests; }
+    // Widgets checked per hit test
+    float getCandidatesPerTest() const
+    {
+        return hitTests ? candidates / (float)hitTests : 0.0f;
+    }
+    void resetStats() { hitTests = candidates = 0; }
+};
+
+inline void
+Widget::setBounds(const SDL_FRect& r)
+{
+    bounds = r;
+    if (ui)
+        ui->invalidateGrid();
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <SDL3/SDL.h>
+
+// The loading bar: a 1 px outline, then a gray part running ahead (e.g.
+// decoded) and a white part (done) filled over it, both 0..1 of the width.
+// Only the geometry and colors live here, so loading.cpp (straight through
+// the renderer, with dirty rects) and ProgressBar in oop.h (through a
+// UiPainter) draw the same bar.
+struct ProgressBarParts
+{
+    static constexpr SDL_FColor outline = { 1.0f, 1.0f, 1.0f, 1.0f };
+    static constexpr SDL_FColor ahead = { 90 / 255.0f,
+                                          90 / 255.0f,
+                                          90 / 255.0f,
+                                          1.0f };
+    static constexpr SDL_FColor done = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+    // The left `fraction` of `bar`, clamped to 0..1
+    static SDL_FRect fill(const SDL_FRect& bar, float fraction)
+    {
+        float w = bar.w * SDL_clamp(fraction, 0.0f, 1.0f);
+        return { bar.x, bar.y, w, bar.h };
+    }
+};
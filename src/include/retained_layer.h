@@ -0,0 +1,240 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <functional>
+#include <vector>
+
+// Retained-mode redraw for mostly static scenes. The static background is
+// drawn once into a render target; the composed frame lives in a second one,
+// because the window's back buffer is undefined after SDL_RenderPresent.
+// Each draw() only restores and redraws the rectangles invalidated since the
+// last one (the foreground is drawn clipped to each of them), then copies the
+// frame to the window and presents. With nothing invalidated it returns
+// without touching the renderer, so an idle scene costs no GPU work at all.
+//
+// Callers invalidate what changed: a moving item both its old and new bounds
+// (see move()), a background change everything (invalidateBackground()).
+class RetainedLayer
+{
+  private:
+    SDL_Renderer* renderer;
+    SDL_Texture* background = nullptr;
+    SDL_Texture* frame = nullptr;
+    int width = 0, height = 0;
+
+    bool backgroundDirty = true;
+    bool presentPending = true; // frame is fine but the window lost it
+    std::vector<SDL_Rect> dirty;
+    static constexpr size_t maxRects = 4;
+
+    // Thống kê
+    Uint64 framesPresented = 0, framesSkipped = 0;
+    Uint64 pixelsComposed = 0, pixelsPresented = 0;
+
+    static Sint64 area(const SDL_Rect& r) { return (Sint64)r.w * r.h; }
+
+    static SDL_Rect unite(const SDL_Rect& a, const SDL_Rect& b)
+    {
+        SDL_Rect r;
+        SDL_GetRectUnion(&a, &b, &r);
+        return r;
+    }
+
+    void add(SDL_Rect rect)
+    {
+        // Gộp với mọi vùng giao nhau, lặp lại vì vùng lớn lên có thể chạm
+        // thêm vùng khác
+        for (size_t i = 0; i < dirty.size();) {
+            if (SDL_HasRectIntersection(&rect, &dirty[i])) {
+                rect = unite(rect, dirty[i]);
+                dirty.erase(dirty.begin() + i);
+                i = 0;
+            } else {
+                i++;
+            }
+        }
+        dirty.push_back(rect);
+
+        // Too many rectangles: merge the pair whose union adds least area
+        while (dirty.size() > maxRects) {
+            size_t bestA = 0, bestB = 1;
+            Sint64 bestCost = -1;
+            for (size_t a = 0; a < dirty.size(); a++)
+                for (size_t b = a + 1; b < dirty.size(); b++) {
+                    Sint64 cost = area(unite(dirty[a], dirty[b])) -
+                                  area(dirty[a]) - area(dirty[b]);
+                    if (bestCost < 0 || cost < bestCost) {
+                        bestCost = cost;
+                        bestA = a;
+                        bestB = b;
+                    }
+                }
+            dirty[bestA] = unite(dirty[bestA], dirty[bestB]);
+            dirty.erase(dirty.begin() + bestB);
+        }
+    }
+
+    static SDL_Texture* target(SDL_Renderer* r, int w, int h)
+    {
+        SDL_Texture* t = SDL_CreateTexture(
+          r, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, w, h);
+        if (t) {
+            SDL_SetTextureBlendMode(t, SDL_BLENDMODE_NONE);
+            SDL_SetTextureScaleMode(t, SDL_SCALEMODE_NEAREST);
+        }
+        return t;
+    }
+
+    bool resize(int w, int h)
+    {
+        SDL_DestroyTexture(background);
+        SDL_DestroyTexture(frame);
+        width = w;
+        height = h;
+        background = target(renderer, w, h);
+        frame = target(renderer, w, h);
+        invalidateBackground();
+        return background && frame;
+    }
+
+  public:
+    explicit RetainedLayer(SDL_Renderer* r)
+      : renderer(r)
+    {
+    }
+
+    RetainedLayer(const RetainedLayer&) = delete;
+    RetainedLayer& operator=(const RetainedLayer&) = delete;
+
+    ~RetainedLayer()
+    {
+        SDL_DestroyTexture(background);
+        SDL_DestroyTexture(frame);
+    }
+
+    void invalidate(const SDL_FRect& rect)
+    {
+        // Ra pixel nguyên, phủ hết cạnh lẻ
+        SDL_Rect r;
+        r.x = (int)SDL_floorf(rect.x);
+        r.y = (int)SDL_floorf(rect.y);
+        r.w = (int)SDL_ceilf(rect.x + rect.w) - r.x;
+        r.h = (int)SDL_ceilf(rect.y + rect.h) - r.y;
+        SDL_Rect bounds = { 0, 0, width, height }, clipped;
+        if (width > 0 && !SDL_GetRectIntersection(&r, &bounds, &clipped))
+            return;
+        add(width > 0 ? clipped : r);
+    }
+
+    void invalidateAll()
+    {
+        dirty.clear();
+        dirty.push_back({ 0, 0, SDL_max(width, 1), SDL_max(height, 1) });
+    }
+
+    // Redraw the background before the next frame
+    void invalidateBackground()
+    {
+        backgroundDirty = true;
+        invalidateAll();
+    }
+
+    // Invalidate `from` and `to` if they differ, then remember `to`
+    void move(SDL_FRect& from, const SDL_FRect& to)
+    {
+        if (SDL_RectsEqualFloat(&from, &to))
+            return;
+        invalidate(from);
+        invalidate(to);
+        from = to;
+    }
+
+    // Window events that lose the presented image or the render targets.
+    // Call from SDL_AppEvent.
+    void handleEvent(const SDL_Event* event)
+    {
+        switch (event->type) {
+            case SDL_EVENT_RENDER_TARGETS_RESET:
+            case SDL_EVENT_RENDER_DEVICE_RESET:
+                invalidateBackground();
+                break;
+            case SDL_EVENT_WINDOW_EXPOSED:
+            case SDL_EVENT_WINDOW_RESTORED:
+                presentPending = true;
+                break;
+            default:
+                break;
+        }
+    }
+
+    bool isDirty() const
+    {
+        return backgroundDirty || presentPending || !dirty.empty();
+    }
+
+    // Compose and present if anything is invalid. `drawBackground` is only
+    // called after invalidateBackground() (or a resize) with the background
+    // target bound; `drawForeground` once per dirty rectangle, clipped to it.
+    // Both draw in output pixels. Returns whether a frame was presented.
+    bool draw(const std::function<void()>& drawBackground,
+              const std::function<void()>& drawForeground)
+    {
+        int w = 0, h = 0;
+        SDL_GetCurrentRenderOutputSize(renderer, &w, &h);
+        if (w != width || h != height || !frame) {
+            if (!resize(w, h))
+                return false;
+        }
+
+        if (!isDirty()) {
+            framesSkipped++;
+            return false;
+        }
+
+        if (backgroundDirty) {
+            SDL_SetRenderTarget(renderer, background);
+            drawBackground();
+            backgroundDirty = false;
+        }
+
+        SDL_SetRenderTarget(renderer, frame);
+        for (const SDL_Rect& rect : dirty) {
+            SDL_FRect r = { (float)rect.x,
+                            (float)rect.y,
+                            (float)rect.w,
+                            (float)rect.h };
+            SDL_SetRenderClipRect(renderer, &rect);
+            SDL_RenderTexture(renderer, background, &r, &r);
+            drawForeground();
+            pixelsComposed += area(rect);
+        }
+        SDL_SetRenderClipRect(renderer, nullptr);
+        dirty.clear();
+
+        SDL_SetRenderTarget(renderer, nullptr);
+        SDL_RenderTexture(renderer, frame, nullptr, nullptr);
+        SDL_RenderPresent(renderer);
+        presentPending = false;
+        framesPresented++;
+        pixelsPresented += (Uint64)width * height;
+        return true;
+    }
+
+    // Sleep until the next event when there is nothing to draw, so an idle
+    // window doesn't spin the callback loop; `timeoutMS` bounds the wait
+    // for scenes that also change on their own
+    void waitWhileIdle(Sint32 timeoutMS)
+    {
+        if (!isDirty())
+            SDL_WaitEventTimeout(nullptr, timeoutMS);
+    }
+
+    Uint64 getFramesPresented() const { return framesPresented; }
+    Uint64 getFramesSkipped() const { return framesSkipped; }
+
+    // Share of presented pixels that had to be recomposed
+    float getComposedRatio() const
+    {
+        return pixelsPresented ? pixelsComposed / (float)pixelsPresented
+                               : 0.0f;
+    }
+};
@@ -0,0 +1,197 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <stddef.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define RIPPLE_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+// Batch update for ripple easing: radius = t * t * maxRadius and
+// alpha = 255 * (1 - t^3) with t = elapsed / lifetime, plus the alive mask
+// (elapsed < lifetime) in the same pass. All variants produce identical
+// results; selectRippleKernel() picks the widest one the CPU supports.
+typedef void (*RippleKernelFn)(const Uint32* start,
+                               float* radius,
+                               float* alpha,
+                               Uint8* alive,
+                               size_t count,
+                               Uint32 now,
+                               Uint32 lifetime,
+                               float maxRadius);
+
+static inline void
+rippleKernelScalar(const Uint32* start,
+                   float* radius,
+                   float* alpha,
+                   Uint8* alive,
+                   size_t count,
+                   Uint32 now,
+                   Uint32 lifetime,
+                   float maxRadius)
+{
+    float invLifetime = 1.0f / lifetime;
+    for (size_t i = 0; i < count; i++) {
+        Uint32 elapsed = now - start[i];
+        alive[i] = elapsed < lifetime;
+        float t = SDL_min(elapsed, lifetime) * invLifetime;
+        radius[i] = t * t * maxRadius;
+        alpha[i] = 255.0f * (1.0f - t * t * t);
+    }
+}
+
+#ifdef RIPPLE_KERNEL_X86
+
+// 8 ripples per iteration (two 4-wide registers)
+__attribute__((target("sse2"))) static inline void
+rippleKernelSSE2(const Uint32* start,
+                 float* radius,
+                 float* alpha,
+                 Uint8* alive,
+                 size_t count,
+                 Uint32 now,
+                 Uint32 lifetime,
+                 float maxRadius)
+{
+    // SSE2 has no unsigned compare, so flip the sign bit of both sides
+    const __m128i sign = _mm_set1_epi32((int)0x80000000u);
+    const __m128i nowV = _mm_set1_epi32((int)now);
+    const __m128i lifeV = _mm_set1_epi32((int)lifetime);
+    const __m128i lifeS = _mm_xor_si128(lifeV, sign);
+    const __m128 inv = _mm_set1_ps(1.0f / lifetime);
+    const __m128 maxR = _mm_set1_ps(maxRadius);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 full = _mm_set1_ps(255.0f);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i e0 = _mm_sub_epi32(
+          nowV, _mm_loadu_si128((const __m128i*)(start + i)));
+        __m128i e1 = _mm_sub_epi32(
+          nowV, _mm_loadu_si128((const __m128i*)(start + i + 4)));
+
+        __m128i live0 = _mm_cmplt_epi32(_mm_xor_si128(e0, sign), lifeS);
+        __m128i live1 = _mm_cmplt_epi32(_mm_xor_si128(e1, sign), lifeS);
+
+        // Dead lanes clamp to lifetime so t stays in [0, 1]
+        e0 = _mm_or_si128(_mm_and_si128(live0, e0),
+                          _mm_andnot_si128(live0, lifeV));
+        e1 = _mm_or_si128(_mm_and_si128(live1, e1),
+                          _mm_andnot_si128(live1, lifeV));
+
+        __m128 t0 = _mm_mul_ps(_mm_cvtepi32_ps(e0), inv);
+        __m128 t1 = _mm_mul_ps(_mm_cvtepi32_ps(e1), inv);
+        __m128 tt0 = _mm_mul_ps(t0, t0);
+        __m128 tt1 = _mm_mul_ps(t1, t1);
+
+        _mm_storeu_ps(radius + i, _mm_mul_ps(tt0, maxR));
+        _mm_storeu_ps(radius + i + 4, _mm_mul_ps(tt1, maxR));
+        _mm_storeu_ps(alpha + i,
+                      _mm_mul_ps(full, _mm_sub_ps(one, _mm_mul_ps(tt0, t0))));
+        _mm_storeu_ps(alpha + i + 4,
+                      _mm_mul_ps(full, _mm_sub_ps(one, _mm_mul_ps(tt1, t1))));
+
+        // 0xFFFFFFFF lanes -> 1 byte each
+        __m128i mask16 = _mm_packs_epi32(live0, live1);
+        __m128i mask8 = _mm_packs_epi16(mask16, mask16);
+        mask8 = _mm_and_si128(mask8, _mm_set1_epi8(1));
+        _mm_storel_epi64((__m128i*)(alive + i), mask8);
+    }
+
+    rippleKernelScalar(start + i,
+                       radius + i,
+                       alpha + i,
+                       alive + i,
+                       count - i,
+                       now,
+                       lifetime,
+                       maxRadius);
+}
+
+// 16 ripples per iteration (two 8-wide registers)
+__attribute__((target("avx2"))) static inline void
+rippleKernelAVX2(const Uint32* start,
+                 float* radius,
+                 float* alpha,
+                 Uint8* alive,
+                 size_t count,
+                 Uint32 now,
+                 Uint32 lifetime,
+                 float maxRadius)
+{
+    const __m256i nowV = _mm256_set1_epi32((int)now);
+    const __m256i lifeV = _mm256_set1_epi32((int)lifetime);
+    const __m256 inv = _mm256_set1_ps(1.0f / lifetime);
+    const __m256 maxR = _mm256_set1_ps(maxRadius);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 full = _mm256_set1_ps(255.0f);
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i e0 = _mm256_sub_epi32(
+          nowV, _mm256_loadu_si256((const __m256i*)(start + i)));
+        __m256i e1 = _mm256_sub_epi32(
+          nowV, _mm256_loadu_si256((const __m256i*)(start + i + 8)));
+
+        // Unsigned min: elapsed < lifetime exactly when min(e, life) != life
+        __m256i c0 = _mm256_min_epu32(e0, lifeV);
+        __m256i c1 = _mm256_min_epu32(e1, lifeV);
+        __m256i dead0 = _mm256_cmpeq_epi32(c0, lifeV);
+        __m256i dead1 = _mm256_cmpeq_epi32(c1, lifeV);
+
+        __m256 t0 = _mm256_mul_ps(_mm256_cvtepi32_ps(c0), inv);
+        __m256 t1 = _mm256_mul_ps(_mm256_cvtepi32_ps(c1), inv);
+        __m256 tt0 = _mm256_mul_ps(t0, t0);
+        __m256 tt1 = _mm256_mul_ps(t1, t1);
+
+        _mm256_storeu_ps(radius + i, _mm256_mul_ps(tt0, maxR));
+        _mm256_storeu_ps(radius + i + 8, _mm256_mul_ps(tt1, maxR));
+        _mm256_storeu_ps(
+          alpha + i,
+          _mm256_mul_ps(full, _mm256_sub_ps(one, _mm256_mul_ps(tt0, t0))));
+        _mm256_storeu_ps(
+          alpha + i + 8,
+          _mm256_mul_ps(full, _mm256_sub_ps(one, _mm256_mul_ps(tt1, t1))));
+
+        // Pack 16 dead masks to bytes; packs works per 128-bit lane, so
+        // reorder the quadwords afterwards
+        __m256i mask16 = _mm256_packs_epi32(dead0, dead1);
+        __m256i mask8 = _mm256_packs_epi16(mask16, mask16);
+        mask8 = _mm256_permutevar8x32_epi32(
+          mask8, _mm256_setr_epi32(0, 4, 1, 5, 0, 0, 0, 0));
+        __m128i bytes = _mm_add_epi8(_mm256_castsi256_si128(mask8),
+                                     _mm_set1_epi8(1)); // dead -1 -> 0
+        _mm_storeu_si128((__m128i*)(alive + i), bytes);
+    }
+
+    rippleKernelScalar(start + i,
+                       radius + i,
+                       alpha + i,
+                       alive + i,
+                       count - i,
+                       now,
+                       lifetime,
+                       maxRadius);
+}
+
+#endif
+
+static inline RippleKernelFn
+selectRippleKernel(const char** name = nullptr)
+{
+#ifdef RIPPLE_KERNEL_X86
+    if (SDL_HasAVX2()) {
+        if (name)
+            *name = "avx2";
+        return rippleKernelAVX2;
+    }
+    if (SDL_HasSSE2()) {
+        if (name)
+            *name = "sse2";
+        return rippleKernelSSE2;
+    }
+#endif
+    if (name)
+        *name = "scalar";
+    return rippleKernelScalar;
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include "ripple_kernel.h"
+#include <vector>
+
+// Fixed-capacity structure-of-arrays pool for click ripples. Each field lives
+// in its own contiguous array, dead ripples are removed by swapping the last
+// one into their slot, and the whole pool is advanced with a single timestamp
+// per frame.
+class RipplePool
+{
+  public:
+    static constexpr Uint32 lifetime = 500; // ms
+    static constexpr float maxRadius = 50.0f;
+
+    std::vector<float> x, y, radius, alpha;
+    std::vector<Uint32> start;
+    std::vector<Uint8> alive;
+
+  private:
+    size_t count = 0;
+    RippleKernelFn kernel;
+    const char* kernelName = "scalar";
+
+    void removeAt(size_t i)
+    {
+        size_t last = --count;
+        x[i] = x[last];
+        y[i] = y[last];
+        radius[i] = radius[last];
+        alpha[i] = alpha[last];
+        start[i] = start[last];
+        alive[i] = alive[last];
+    }
+
+  public:
+    RipplePool(size_t capacity = 65536)
+      : x(capacity)
+      , y(capacity)
+      , radius(capacity)
+      , alpha(capacity)
+      , start(capacity)
+      , alive(capacity)
+    {
+        kernel = selectRippleKernel(&kernelName);
+    }
+
+    size_t size() const { return count; }
+    size_t capacity() const { return start.size(); }
+    bool empty() const { return count == 0; }
+    const char* getKernelName() const { return kernelName; }
+
+    void setKernel(RippleKernelFn fn, const char* name)
+    {
+        kernel = fn;
+        kernelName = name;
+    }
+
+    // Trả về false khi pool đầy; click đó bị bỏ qua thay vì cấp phát thêm
+    bool spawn(float px, float py, Uint32 now)
+    {
+        if (count == capacity())
+            return false;
+
+        x[count] = px;
+        y[count] = py;
+        radius[count] = 0.0f;
+        alpha[count] = 255.0f;
+        start[count] = now;
+        count++;
+        return true;
+    }
+
+    void update(Uint32 now)
+    {
+        kernel(start.data(),
+               radius.data(),
+               alpha.data(),
+               alive.data(),
+               count,
+               now,
+               lifetime,
+               maxRadius);
+
+        for (size_t i = 0; i < count;) {
+            // Phần tử cuối được đổi vào chỗ i, nên xét lại i
+            if (!alive[i])
+                removeAt(i);
+            else
+                i++;
+        }
+    }
+
+    void clear() { count = 0; }
+};
@@ -0,0 +1,130 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <glm/glm.hpp>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+// Transform hierarchy kept as flat arrays in depth-first order: every parent
+// comes before its children and a subtree is the contiguous index range
+// [i, i + subtreeSize[i]). World matrices are only recomputed for subtrees
+// whose root had its local matrix changed since the last Update(), in one
+// forward pass where each parent's world matrix is already up to date.
+//
+// Nodes are referred to by stable handles. Adding nodes in depth-first order
+// (parent, then its children, then the next sibling) only ever appends;
+// adding a child to an earlier subtree shifts every later node.
+class SceneGraph
+{
+  public:
+    typedef Uint32 Node;
+    static constexpr Node none = 0xFFFFFFFFu;
+
+    // Index range [first, second) whose world matrices were recomputed
+    typedef std::pair<Uint32, Uint32> Range;
+
+  private:
+    // Theo thứ tự depth-first
+    std::vector<Sint32> parent; // index của node cha, -1 với node gốc
+    std::vector<Uint32> subtreeSize;
+    std::vector<glm::mat4> local;
+    std::vector<glm::mat4> world;
+    std::vector<Uint8> dirty;
+    std::vector<Node> handleOf;
+
+    std::vector<Uint32> indexOf; // handle -> index
+    size_t dirtyCount = 0;
+
+  public:
+    Node Add(Node parentNode = none,
+             const glm::mat4& localMatrix = glm::mat4(1.0f))
+    {
+        Sint32 parentIndex = parentNode == none ? -1 : indexOf[parentNode];
+        Uint32 at = parentIndex < 0 ? (Uint32)parent.size()
+                                    : parentIndex + subtreeSize[parentIndex];
+
+        parent.insert(parent.begin() + at, parentIndex);
+        subtreeSize.insert(subtreeSize.begin() + at, 1);
+        local.insert(local.begin() + at, localMatrix);
+        world.insert(world.begin() + at, localMatrix);
+        dirty.insert(dirty.begin() + at, 1);
+        dirtyCount++;
+
+        Node node = (Node)indexOf.size();
+        handleOf.insert(handleOf.begin() + at, node);
+        indexOf.push_back(at);
+
+        // Dời các node phía sau (chỉ xảy ra khi không thêm theo thứ tự DFS)
+        for (Uint32 i = at + 1; i < parent.size(); i++) {
+            indexOf[handleOf[i]] = i;
+            if (parent[i] >= (Sint32)at)
+                parent[i]++;
+        }
+        for (Sint32 p = parentIndex; p >= 0; p = parent[p])
+            subtreeSize[p]++;
+        return node;
+    }
+
+    void SetLocal(Node node, const glm::mat4& localMatrix)
+    {
+        Uint32 i = indexOf[node];
+        local[i] = localMatrix;
+        if (!dirty[i]) {
+            dirty[i] = 1;
+            dirtyCount++;
+        }
+    }
+
+    // Recompute world matrices of every dirty subtree. Appends the index
+    // ranges that changed to `changed` when given and returns how many world
+    // matrices were recomputed.
+    size_t Update(std::vector<Range>* changed = nullptr)
+    {
+        if (dirtyCount == 0)
+            return 0;
+
+        size_t updated = 0;
+        const Uint8* flags = dirty.data();
+        Uint32 count = (Uint32)dirty.size();
+        for (Uint32 i = 0; i < count;) {
+            // Bỏ qua nhanh đoạn sạch
+            const Uint8* next = (const Uint8*)memchr(flags + i, 1, count - i);
+            if (!next)
+                break;
+            i = (Uint32)(next - flags);
+
+            Uint32 end = i + subtreeSize[i];
+            for (Uint32 j = i; j < end; j++) {
+                world[j] =
+                  parent[j] < 0 ? local[j] : world[parent[j]] * local[j];
+                dirty[j] = 0;
+            }
+            if (changed)
+                changed->push_back({ i, end });
+            updated += end - i;
+            i = end;
+        }
+        dirtyCount = 0;
+        return updated;
+    }
+
+    void Clear()
+    {
+        parent.clear();
+        subtreeSize.clear();
+        local.clear();
+        world.clear();
+        dirty.clear();
+        handleOf.clear();
+        indexOf.clear();
+        dirtyCount = 0;
+    }
+
+    size_t Size() const { return parent.size(); }
+    Uint32 IndexOf(Node node) const { return indexOf[node]; }
+    const glm::mat4& GetLocal(Node node) const { return local[indexOf[node]]; }
+    const glm::mat4& GetWorld(Node node) const { return world[indexOf[node]]; }
+
+    // World matrices in depth-first order, valid after Update()
+    const glm::mat4* WorldMatrices() const { return world.data(); }
+};
@@ -0,0 +1,192 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include "glyph_cache.h"
+
+// Sharp text at any scale from a GlyphCache in Sdf mode. The renderer has no
+// pixel shaders for the usual alpha test, so the threshold is done by
+// blending over two render targets: begin() sends drawing to a mask where
+// the glyph quads combine by maximum; end() subtracts the threshold from the
+// mask, doubles it until the edge ramp is about one pixel wide, then scales
+// the destination by (1 - mask) and adds mask * color. All of that happens
+// inside the clip rectangle active at begin(), in a fixed number of draws.
+//
+// Everything drawn between begin() and end() shares one color and one
+// scale. Needs custom blend modes; check isSupported() first.
+class SdfText
+{
+  private:
+    SDL_Renderer* renderer;
+    SDL_Texture* mask = nullptr;
+    SDL_Texture* scratch = nullptr;
+    int width = 0, height = 0;
+    bool supported = false;
+
+    SDL_Texture* previous = nullptr;
+    SDL_Rect area = {};
+    SDL_FRect areaF = {};
+    int passes = 0; // draws in the last end()
+
+    // dst - src on the color channels
+    const SDL_BlendMode subtract =
+      SDL_ComposeCustomBlendMode(SDL_BLENDFACTOR_ONE,
+                                 SDL_BLENDFACTOR_ONE,
+                                 SDL_BLENDOPERATION_REV_SUBTRACT,
+                                 SDL_BLENDFACTOR_ZERO,
+                                 SDL_BLENDFACTOR_ONE,
+                                 SDL_BLENDOPERATION_ADD);
+    // dst * (1 - src) on the color channels
+    const SDL_BlendMode cutout =
+      SDL_ComposeCustomBlendMode(SDL_BLENDFACTOR_ZERO,
+                                 SDL_BLENDFACTOR_ONE_MINUS_SRC_COLOR,
+                                 SDL_BLENDOPERATION_ADD,
+                                 SDL_BLENDFACTOR_ZERO,
+                                 SDL_BLENDFACTOR_ONE,
+                                 SDL_BLENDOPERATION_ADD);
+
+    static constexpr int maxDoublings = 8;
+
+    static SDL_Texture* target(SDL_Renderer* r, int w, int h)
+    {
+        SDL_Texture* t = SDL_CreateTexture(
+          r, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, w, h);
+        if (t)
+            SDL_SetTextureScaleMode(t, SDL_SCALEMODE_NEAREST);
+        return t;
+    }
+
+    bool resize(int w, int h)
+    {
+        SDL_DestroyTexture(mask);
+        SDL_DestroyTexture(scratch);
+        width = w;
+        height = h;
+        mask = target(renderer, w, h);
+        scratch = target(renderer, w, h);
+        return mask && scratch;
+    }
+
+  public:
+    explicit SdfText(SDL_Renderer* r)
+      : renderer(r)
+    {
+        // Thử các blend mode tự chọn trên một target nhỏ
+        SDL_Texture* probe = target(renderer, 1, 1);
+        supported = probe && SDL_SetTextureBlendMode(probe, subtract) &&
+                    SDL_SetTextureBlendMode(probe, cutout) &&
+                    SDL_SetTextureBlendMode(
+                      probe,
+                      SDL_ComposeCustomBlendMode(SDL_BLENDFACTOR_ONE,
+                                                 SDL_BLENDFACTOR_ONE,
+                                                 SDL_BLENDOPERATION_MAXIMUM,
+                                                 SDL_BLENDFACTOR_ONE,
+                                                 SDL_BLENDFACTOR_ONE,
+                                                 SDL_BLENDOPERATION_MAXIMUM));
+        SDL_DestroyTexture(probe);
+    }
+
+    SdfText(const SdfText&) = delete;
+    SdfText& operator=(const SdfText&) = delete;
+
+    ~SdfText()
+    {
+        SDL_DestroyTexture(mask);
+        SDL_DestroyTexture(scratch);
+    }
+
+    bool isSupported() const { return supported; }
+
+    // Redirect drawing to the mask until end(). Draw the glyph quads white.
+    bool begin()
+    {
+        int w = 0, h = 0;
+        SDL_GetCurrentRenderOutputSize(renderer, &w, &h);
+        if (w != width || h != height || !mask) {
+            if (!resize(w, h))
+                return false;
+        }
+
+        previous = SDL_GetRenderTarget(renderer);
+        area = { 0, 0, w, h };
+        if (SDL_RenderClipEnabled(renderer))
+            SDL_GetRenderClipRect(renderer, &area);
+        areaF = { (float)area.x, (float)area.y, (float)area.w, (float)area.h };
+
+        SDL_SetRenderTarget(renderer, mask);
+        SDL_SetRenderClipRect(renderer, &area);
+        SDL_BlendMode blend;
+        SDL_GetRenderDrawBlendMode(renderer, &blend);
+        SDL_FColor color;
+        SDL_GetRenderDrawColorFloat(
+          renderer, &color.r, &color.g, &color.b, &color.a);
+
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+        SDL_SetRenderDrawColorFloat(renderer, 0.0f, 0.0f, 0.0f, 1.0f);
+        SDL_RenderFillRect(renderer, &areaF);
+
+        SDL_SetRenderDrawBlendMode(renderer, blend);
+        SDL_SetRenderDrawColorFloat(
+          renderer, color.r, color.g, color.b, color.a);
+        return true;
+    }
+
+    // Threshold the mask and blend it over the target that was bound at
+    // begin(). `scale` is the GlyphCache::getScale() the quads were drawn
+    // with; it sets how steep the edge has to be.
+    void end(SDL_FColor color, float scale)
+    {
+        // Dốc của trường: 1 pixel màn hình = 1 / (2 * spread * scale)
+        float steepness = 2.0f * GlyphCache::sdfSpread * scale;
+        int doublings = 0;
+        while (doublings < maxDoublings && (1 << doublings) < steepness)
+            doublings++;
+        float threshold = 0.5f - 0.5f / (1 << doublings);
+        passes = 0;
+
+        SDL_BlendMode blend;
+        SDL_GetRenderDrawBlendMode(renderer, &blend);
+        SDL_FColor drawColor;
+        SDL_GetRenderDrawColorFloat(renderer,
+                                    &drawColor.r,
+                                    &drawColor.g,
+                                    &drawColor.b,
+                                    &drawColor.a);
+
+        // (mask - threshold) * 2^doublings, clamped to 0..1
+        if (threshold > 0.0f) {
+            SDL_SetRenderDrawBlendMode(renderer, subtract);
+            SDL_SetRenderDrawColorFloat(
+              renderer, threshold, threshold, threshold, 1.0f);
+            SDL_RenderFillRect(renderer, &areaF);
+            passes++;
+        }
+        for (int i = 0; i < doublings; i++) {
+            SDL_SetRenderTarget(renderer, scratch);
+            SDL_SetRenderClipRect(renderer, &area);
+            SDL_SetTextureBlendMode(mask, SDL_BLENDMODE_NONE);
+            SDL_RenderTexture(renderer, mask, &areaF, &areaF);
+
+            SDL_SetRenderTarget(renderer, mask);
+            SDL_SetTextureBlendMode(scratch, SDL_BLENDMODE_ADD);
+            SDL_RenderTexture(renderer, scratch, &areaF, &areaF);
+            passes += 2;
+        }
+
+        // dst * (1 - mask * a) + mask * color * a
+        SDL_SetRenderTarget(renderer, previous);
+        SDL_SetTextureBlendMode(mask, cutout);
+        SDL_SetTextureColorModFloat(mask, color.a, color.a, color.a);
+        SDL_SetTextureAlphaModFloat(mask, 1.0f);
+        SDL_RenderTexture(renderer, mask, &areaF, &areaF);
+        SDL_SetTextureBlendMode(mask, SDL_BLENDMODE_ADD);
+        SDL_SetTextureColorModFloat(mask, color.r, color.g, color.b);
+        SDL_SetTextureAlphaModFloat(mask, color.a);
+        SDL_RenderTexture(renderer, mask, &areaF, &areaF);
+        passes += 2;
+
+        SDL_SetRenderDrawBlendMode(renderer, blend);
+        SDL_SetRenderDrawColorFloat(
+          renderer, drawColor.r, drawColor.g, drawColor.b, drawColor.a);
+    }
+
+    int getPasses() const { return passes; }
+};
@@ -0,0 +1,200 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+// Vertex after projection: screen-space position, NDC depth, 1/w for
+// perspective-correct interpolation and the color to interpolate
+struct RasterVertex
+{
+    float x, y, z, invW;
+    glm::vec3 color;
+};
+
+// CPU framebuffer (ARGB8888) with a per-pixel depth buffer. Triangles are set
+// up with edge functions and traversed in small tiles: tiles fully outside an
+// edge are skipped, tiles fully inside skip the per-pixel edge tests. Colors
+// are Gouraud-interpolated with perspective correction.
+class SoftRasterizer
+{
+  public:
+    static constexpr int tileSize = 8;
+
+  private:
+    int width = 0, height = 0;
+    std::vector<Uint32> color;
+    std::vector<float> depth;
+
+    struct Edge
+    {
+        float a, b, c; // E(x, y) = a * x + b * y + c
+        bool topLeft;
+
+        float At(float x, float y) const { return a * x + b * y + c; }
+        bool Inside(float w) const
+        {
+            return w > 0.0f || (w == 0.0f && topLeft);
+        }
+    };
+
+    // Edge from p to q; positive on the interior side once the triangle has
+    // been wound so that its area is positive
+    static Edge MakeEdge(const RasterVertex& p, const RasterVertex& q)
+    {
+        Edge e;
+        e.a = -(q.y - p.y);
+        e.b = q.x - p.x;
+        e.c = (q.y - p.y) * p.x - (q.x - p.x) * p.y;
+        // Top edge: horizontal with the interior below; left edge: going up
+        float dy = q.y - p.y;
+        e.topLeft = (dy == 0.0f && q.x > p.x) || dy < 0.0f;
+        return e;
+    }
+
+    static Uint32 Pack(const glm::vec3& c)
+    {
+        Uint32 r = (Uint32)(SDL_clamp(c.r, 0.0f, 1.0f) * 255.0f + 0.5f);
+        Uint32 g = (Uint32)(SDL_clamp(c.g, 0.0f, 1.0f) * 255.0f + 0.5f);
+        Uint32 b = (Uint32)(SDL_clamp(c.b, 0.0f, 1.0f) * 255.0f + 0.5f);
+        return 0xFF000000u | (r << 16) | (g << 8) | b;
+    }
+
+  public:
+    void Resize(int w, int h)
+    {
+        width = std::max(w, 1);
+        height = std::max(h, 1);
+        color.assign((size_t)width * height, 0);
+        depth.assign((size_t)width * height,
+                     std::numeric_limits<float>::infinity());
+    }
+
+    int GetWidth() const { return width; }
+    int GetHeight() const { return height; }
+    const Uint32* GetPixels() const { return color.data(); }
+    int GetPitch() const { return width * (int)sizeof(Uint32); }
+
+    // Clear the whole target, or only `region` so separate threads can each
+    // clear the tiles they own
+    void Clear(Uint32 argb, const SDL_Rect* region = nullptr)
+    {
+        SDL_Rect r = region ? *region : SDL_Rect{ 0, 0, width, height };
+        for (int y = r.y; y < r.y + r.h; y++) {
+            size_t row = (size_t)y * width;
+            std::fill(color.begin() + row + r.x,
+                      color.begin() + row + r.x + r.w,
+                      argb);
+            std::fill(depth.begin() + row + r.x,
+                      depth.begin() + row + r.x + r.w,
+                      std::numeric_limits<float>::infinity());
+        }
+    }
+
+    // Rasterize one triangle, touching only pixels inside `clip` (the whole
+    // target when null). Vertices must be in front of the camera (invW > 0).
+    void DrawTriangle(const RasterVertex& v0,
+                      const RasterVertex& v1,
+                      const RasterVertex& v2,
+                      const SDL_Rect* clip = nullptr)
+    {
+        const RasterVertex* a = &v0;
+        const RasterVertex* b = &v1;
+        const RasterVertex* c = &v2;
+
+        float area = (b->x - a->x) * (c->y - a->y) -
+                     (b->y - a->y) * (c->x - a->x);
+        if (area == 0.0f)
+            return;
+        if (area < 0.0f) {
+            std::swap(b, c);
+            area = -area;
+        }
+
+        SDL_Rect bounds = clip ? *clip : SDL_Rect{ 0, 0, width, height };
+        int minX = std::max(bounds.x,
+                            (int)SDL_floorf(std::min({ a->x, b->x, c->x })));
+        int minY = std::max(bounds.y,
+                            (int)SDL_floorf(std::min({ a->y, b->y, c->y })));
+        int maxX = std::min(bounds.x + bounds.w - 1,
+                            (int)SDL_ceilf(std::max({ a->x, b->x, c->x })));
+        int maxY = std::min(bounds.y + bounds.h - 1,
+                            (int)SDL_ceilf(std::max({ a->y, b->y, c->y })));
+        if (minX > maxX || minY > maxY)
+            return;
+
+        // e0 weights a, e1 weights b, e2 weights c
+        Edge e0 = MakeEdge(*b, *c);
+        Edge e1 = MakeEdge(*c, *a);
+        Edge e2 = MakeEdge(*a, *b);
+        float invArea = 1.0f / area;
+
+        // Pre-divide attributes by w so they interpolate linearly on screen
+        glm::vec3 ca = a->color * a->invW;
+        glm::vec3 cb = b->color * b->invW;
+        glm::vec3 cc = c->color * c->invW;
+
+        auto shade = [&](int px, int py, float w0, float w1, float w2) {
+            float l0 = w0 * invArea, l1 = w1 * invArea, l2 = w2 * invArea;
+            float z = l0 * a->z + l1 * b->z + l2 * c->z;
+            size_t idx = (size_t)py * width + px;
+            if (z >= depth[idx])
+                return;
+            depth[idx] = z;
+            float invW = l0 * a->invW + l1 * b->invW + l2 * c->invW;
+            color[idx] = Pack((ca * l0 + cb * l1 + cc * l2) / invW);
+        };
+
+        int tileX0 = minX & ~(tileSize - 1);
+        int tileY0 = minY & ~(tileSize - 1);
+        for (int ty = tileY0; ty <= maxY; ty += tileSize) {
+            for (int tx = tileX0; tx <= maxX; tx += tileSize) {
+                int x0 = std::max(tx, minX);
+                int y0 = std::max(ty, minY);
+                int x1 = std::min(tx + tileSize - 1, maxX);
+                int y1 = std::min(ty + tileSize - 1, maxY);
+
+                // Edge functions are linear, so their extremes over the tile's
+                // pixel centers are at its corners
+                float cx0 = x0 + 0.5f, cx1 = x1 + 0.5f;
+                float cy0 = y0 + 0.5f, cy1 = y1 + 0.5f;
+                bool outside = false, inside = true;
+                for (const Edge* e : { &e0, &e1, &e2 }) {
+                    float k[4] = { e->At(cx0, cy0),
+                                   e->At(cx1, cy0),
+                                   e->At(cx0, cy1),
+                                   e->At(cx1, cy1) };
+                    float lo = std::min({ k[0], k[1], k[2], k[3] });
+                    float hi = std::max({ k[0], k[1], k[2], k[3] });
+                    if (hi < 0.0f) {
+                        outside = true;
+                        break;
+                    }
+                    if (lo <= 0.0f)
+                        inside = false;
+                }
+                if (outside)
+                    continue;
+
+                float row0 = e0.At(cx0, cy0);
+                float row1 = e1.At(cx0, cy0);
+                float row2 = e2.At(cx0, cy0);
+                for (int py = y0; py <= y1; py++) {
+                    float w0 = row0, w1 = row1, w2 = row2;
+                    for (int px = x0; px <= x1; px++) {
+                        if (inside || (e0.Inside(w0) && e1.Inside(w1) &&
+                                       e2.Inside(w2)))
+                            shade(px, py, w0, w1, w2);
+                        w0 += e0.a;
+                        w1 += e1.a;
+                        w2 += e2.a;
+                    }
+                    row0 += e0.b;
+                    row1 += e1.b;
+                    row2 += e2.b;
+                }
+            }
+        }
+    }
+};
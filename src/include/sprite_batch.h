@@ -0,0 +1,140 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <vector>
+
+// Collects textured quads (position, scale, rotation, tint, optional source
+// rect) and submits every consecutive run that shares a texture as a single
+// SDL_RenderGeometry call. Drawing with a different texture flushes the
+// pending run first, so draw order is preserved.
+class SpriteBatch
+{
+  private:
+    SDL_Renderer* renderer;
+    SDL_Texture* texture = nullptr;
+    float textureWidth = 0.0f, textureHeight = 0.0f;
+
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices; // 0 1 2 2 3 0 per quad, only ever grows
+
+    int sprites = 0, drawCalls = 0;
+
+    void bind(SDL_Texture* t)
+    {
+        if (t == texture)
+            return;
+        flush();
+        texture = t;
+        SDL_GetTextureSize(t, &textureWidth, &textureHeight);
+    }
+
+  public:
+    static constexpr SDL_FColor white = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+    explicit SpriteBatch(SDL_Renderer* r)
+      : renderer(r)
+    {
+    }
+
+    // Queue `src` of `t` (the whole texture when null) stretched over `dst`,
+    // rotated by `angle` radians around the center of dst
+    void draw(SDL_Texture* t,
+              const SDL_FRect& dst,
+              float angle = 0.0f,
+              SDL_FColor tint = white,
+              const SDL_FRect* src = nullptr)
+    {
+        bind(t);
+
+        float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+        if (src) {
+            u0 = src->x / textureWidth;
+            v0 = src->y / textureHeight;
+            u1 = (src->x + src->w) / textureWidth;
+            v1 = (src->y + src->h) / textureHeight;
+        }
+
+        float hw = dst.w * 0.5f, hh = dst.h * 0.5f;
+        float cx = dst.x + hw, cy = dst.y + hh;
+        float c = 1.0f, s = 0.0f;
+        if (angle != 0.0f) {
+            c = SDL_cosf(angle);
+            s = SDL_sinf(angle);
+        }
+
+        // Corners relative to the center: TL, TR, BR, BL
+        const float corners[4][2] = {
+            { -hw, -hh }, { hw, -hh }, { hw, hh }, { -hw, hh }
+        };
+        const float uv[4][2] = {
+            { u0, v0 }, { u1, v0 }, { u1, v1 }, { u0, v1 }
+        };
+
+        size_t base = vertices.size();
+        vertices.resize(base + 4);
+        for (int k = 0; k < 4; k++) {
+            SDL_Vertex& v = vertices[base + k];
+            v.position.x = cx + corners[k][0] * c - corners[k][1] * s;
+            v.position.y = cy + corners[k][0] * s + corners[k][1] * c;
+            v.color = tint;
+            v.tex_coord.x = uv[k][0];
+            v.tex_coord.y = uv[k][1];
+        }
+        sprites++;
+    }
+
+    // Whole texture centered on (x, y), scaled by `scale`
+    void draw(SDL_Texture* t,
+              float x,
+              float y,
+              float scale,
+              float angle = 0.0f,
+              SDL_FColor tint = white)
+    {
+        bind(t);
+        float w = textureWidth * scale, h = textureHeight * scale;
+        draw(t, SDL_FRect{ x - w * 0.5f, y - h * 0.5f, w, h }, angle, tint);
+    }
+
+    // `src` of `t` (e.g. an atlas sprite) centered on (x, y), scaled by
+    // `scale`
+    void draw(SDL_Texture* t,
+              const SDL_FRect& src,
+              float x,
+              float y,
+              float scale,
+              float angle = 0.0f,
+              SDL_FColor tint = white)
+    {
+        float w = src.w * scale, h = src.h * scale;
+        draw(t,
+             SDL_FRect{ x - w * 0.5f, y - h * 0.5f, w, h },
+             angle,
+             tint,
+             &src);
+    }
+
+    void flush()
+    {
+        int quads = (int)(vertices.size() / 4);
+        if (quads == 0)
+            return;
+
+        while ((int)indices.size() < quads * 6) {
+            int v = (int)indices.size() / 6 * 4;
+            indices.insert(indices.end(), { v, v + 1, v + 2, v + 2, v + 3, v });
+        }
+        SDL_RenderGeometry(renderer,
+                           texture,
+                           vertices.data(),
+                           (int)vertices.size(),
+                           indices.data(),
+                           quads * 6);
+        vertices.clear();
+        drawCalls++;
+    }
+
+    // Sprites queued and draw calls issued since the last resetStats()
+    int getSpriteCount() const { return sprites; }
+    int getDrawCalls() const { return drawCalls; }
+    void resetStats() { sprites = drawCalls = 0; }
+};
@@ -0,0 +1,182 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include "glyph_cache.h"
+#include "sprite_batch.h"
+#include <vector>
+
+// One positioned glyph: where it goes relative to the text's top-left corner
+// and where its pixels are in the glyph atlas
+struct GlyphQuad
+{
+    SDL_Texture* texture;
+    SDL_FRect dst;
+    SDL_FRect src;
+};
+
+// Turns UTF-8 strings into glyph quads from a GlyphCache: kerning, '\n' line
+// breaks, word wrap at spaces and per-line alignment. Quads go through a
+// SpriteBatch, so any number of labels drawn between two flushes reach the
+// renderer as one SDL_RenderGeometry call per atlas page (normally one).
+// Static text can be shaped once and the quads kept; changing text is cheap
+// to reshape every frame since the glyphs are only looked up. With a cache
+// in Sdf mode the quads are scaled to the font's current size.
+class TextLayout
+{
+  public:
+    enum Align
+    {
+        Left,
+        Center,
+        Right
+    };
+
+  private:
+    struct Line
+    {
+        size_t first; // index of the line's first quad
+        float width;
+    };
+
+    GlyphCache& cache;
+    std::vector<GlyphQuad> scratch;
+    std::vector<Line> lines;
+
+  public:
+    explicit TextLayout(GlyphCache& c)
+      : cache(c)
+    {
+    }
+
+    // Append the quads of `text` to `quads` and return the size of the block.
+    // Lines wrap at the last space before `wrapWidth` when it is positive and
+    // are aligned within it (within the widest line otherwise).
+    SDL_FPoint shape(TTF_Font* font,
+                     const char* text,
+                     std::vector<GlyphQuad>& quads,
+                     float wrapWidth = 0.0f,
+                     Align align = Left)
+    {
+        const float lineSkip = (float)TTF_GetFontLineSkip(font);
+        const float scale = cache.getScale(font);
+        const size_t start = quads.size();
+        const size_t none = (size_t)-1;
+
+        lines.clear();
+        size_t lineFirst = start;
+        size_t breakQuad = none; // first quad after the last space
+        float breakX = 0.0f, breakWidth = 0.0f;
+        float penX = 0.0f, penY = 0.0f;
+        Uint32 previous = 0;
+
+        size_t length = SDL_strlen(text);
+        while (length > 0) {
+            Uint32 codepoint = SDL_StepUTF8(&text, &length);
+            if (codepoint == '\n') {
+                lines.push_back({ lineFirst, penX });
+                lineFirst = quads.size();
+                breakQuad = none;
+                penX = 0.0f;
+                penY += lineSkip;
+                previous = 0;
+                continue;
+            }
+
+            int kerning = 0;
+            if (previous &&
+                TTF_GetGlyphKerning(font, previous, codepoint, &kerning))
+                penX += kerning;
+
+            const GlyphCache::Glyph& glyph = cache.get(font, codepoint);
+            const float advance = glyph.advance * scale;
+
+            // Tràn dòng: chuyển phần sau dấu cách cuối cùng xuống dòng mới
+            if (wrapWidth > 0.0f && codepoint != ' ' && breakQuad != none &&
+                penX + advance > wrapWidth) {
+                lines.push_back({ lineFirst, breakWidth });
+                for (size_t i = breakQuad; i < quads.size(); i++) {
+                    quads[i].dst.x -= breakX;
+                    quads[i].dst.y += lineSkip;
+                }
+                penX -= breakX;
+                penY += lineSkip;
+                lineFirst = breakQuad;
+                breakQuad = none;
+            }
+
+            if (glyph.texture)
+                quads.push_back({ glyph.texture,
+                                  { penX + glyph.offsetX * scale,
+                                    penY + glyph.offsetY * scale,
+                                    glyph.src.w * scale,
+                                    glyph.src.h * scale },
+                                  glyph.src });
+            if (codepoint == ' ') {
+                breakQuad = quads.size();
+                breakWidth = penX;
+                breakX = penX + advance;
+            }
+            penX += advance;
+            previous = codepoint;
+        }
+        lines.push_back({ lineFirst, penX });
+
+        float width = 0.0f;
+        for (const Line& line : lines)
+            width = SDL_max(width, line.width);
+
+        if (align != Left) {
+            float box = wrapWidth > 0.0f ? wrapWidth : width;
+            for (size_t l = 0; l < lines.size(); l++) {
+                float shift = box - lines[l].width;
+                if (align == Center)
+                    shift = SDL_floorf(shift * 0.5f);
+                size_t end =
+                  l + 1 < lines.size() ? lines[l + 1].first : quads.size();
+                for (size_t i = lines[l].first; i < end; i++)
+                    quads[i].dst.x += shift;
+            }
+        }
+        return { width, lines.size() * lineSkip };
+    }
+
+    SDL_FPoint measure(TTF_Font* font,
+                       const char* text,
+                       float wrapWidth = 0.0f)
+    {
+        scratch.clear();
+        return shape(font, text, scratch, wrapWidth);
+    }
+
+    // Queue shaped quads with their top-left corner at (x, y), snapped to
+    // whole pixels so the glyphs stay sharp
+    void draw(SpriteBatch& batch,
+              const std::vector<GlyphQuad>& quads,
+              float x,
+              float y,
+              SDL_FColor color = SpriteBatch::white)
+    {
+        x = SDL_floorf(x);
+        y = SDL_floorf(y);
+        for (const GlyphQuad& q : quads) {
+            SDL_FRect dst = { q.dst.x + x, q.dst.y + y, q.dst.w, q.dst.h };
+            batch.draw(q.texture, dst, 0.0f, color, &q.src);
+        }
+    }
+
+    // Shape and queue `text` in one go; returns the size of the block
+    SDL_FPoint draw(SpriteBatch& batch,
+                    TTF_Font* font,
+                    const char* text,
+                    float x,
+                    float y,
+                    SDL_FColor color = SpriteBatch::white,
+                    float wrapWidth = 0.0f,
+                    Align align = Left)
+    {
+        scratch.clear();
+        SDL_FPoint size = shape(font, text, scratch, wrapWidth, align);
+        draw(batch, scratch, x, y, color);
+        return size;
+    }
+};
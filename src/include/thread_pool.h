@@ -0,0 +1,186 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Persistent worker threads running parallel-for jobs with work stealing.
+// Each participant (the workers plus the calling thread) starts with a
+// contiguous slice of the index range and takes items from its front; when it
+// runs dry it steals the back half of another participant's slice. Slices are
+// single 64-bit atomics (begin | end << 32), so scheduling never takes a lock.
+class ThreadPool
+{
+  private:
+    struct alignas(64) Slice
+    {
+        std::atomic<Uint64> bounds{ 0 };
+    };
+
+    static Uint64 Pack(Uint32 begin, Uint32 end)
+    {
+        return (Uint64)begin | ((Uint64)end << 32);
+    }
+
+    std::vector<std::thread> workers;
+    std::unique_ptr<Slice[]> slices;
+    int participants = 1; // threads used by the current job, caller included
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    Uint64 generation = 0;
+    int active = 0;
+    bool stopping = false;
+
+    std::function<void(int index, int thread)> job;
+
+    bool PopFront(Slice& slice, int& index)
+    {
+        Uint64 cur = slice.bounds.load(std::memory_order_relaxed);
+        for (;;) {
+            Uint32 begin = (Uint32)cur, end = (Uint32)(cur >> 32);
+            if (begin >= end)
+                return false;
+            if (slice.bounds.compare_exchange_weak(
+                  cur, Pack(begin + 1, end), std::memory_order_acquire)) {
+                index = (int)begin;
+                return true;
+            }
+        }
+    }
+
+    bool Steal(int thief)
+    {
+        for (int k = 1; k < participants; k++) {
+            Slice& victim = slices[(thief + k) % participants];
+            Uint64 cur = victim.bounds.load(std::memory_order_relaxed);
+            for (;;) {
+                Uint32 begin = (Uint32)cur, end = (Uint32)(cur >> 32);
+                if (begin >= end)
+                    break;
+                Uint32 take = std::max<Uint32>(1, (end - begin) / 2);
+                if (victim.bounds.compare_exchange_weak(
+                      cur,
+                      Pack(begin, end - take),
+                      std::memory_order_acquire)) {
+                    // Our own slice is empty, so nobody can be stealing from
+                    // it right now and a plain store is enough
+                    slices[thief].bounds.store(Pack(end - take, end),
+                                               std::memory_order_release);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void RunSlice(int thread)
+    {
+        int index;
+        for (;;) {
+            while (PopFront(slices[thread], index))
+                job(index, thread);
+            if (!Steal(thread))
+                return;
+        }
+    }
+
+    void WorkerLoop(int thread)
+    {
+        Uint64 seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock,
+                          [&] { return stopping || generation != seen; });
+                if (stopping)
+                    return;
+                seen = generation;
+                if (thread >= participants)
+                    continue;
+            }
+
+            RunSlice(thread);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--active == 0)
+                done.notify_one();
+        }
+    }
+
+  public:
+    // `threads` counts the calling thread; 0 means one per logical core
+    explicit ThreadPool(int threads = 0)
+    {
+        if (threads <= 0)
+            threads = std::max(1, SDL_GetNumLogicalCPUCores());
+        slices.reset(new Slice[threads]);
+        participants = threads;
+        for (int i = 1; i < threads; i++)
+            workers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& worker : workers)
+            worker.join();
+    }
+
+    int GetMaxThreads() const { return (int)workers.size() + 1; }
+
+    // Run fn(index, thread) for every index in [0, count) on up to `threads`
+    // threads (all of them when <= 0) and return once all are done. `thread`
+    // is in [0, threads) and stable for the duration of one call, so it can
+    // index per-thread scratch data.
+    void ParallelFor(int count,
+                     std::function<void(int index, int thread)> fn,
+                     int threads = 0)
+    {
+        if (count <= 0)
+            return;
+        int n = threads <= 0 ? GetMaxThreads()
+                             : std::min(threads, GetMaxThreads());
+        n = std::min(n, count);
+        if (n == 1) {
+            for (int i = 0; i < count; i++)
+                fn(i, 0);
+            return;
+        }
+
+        job = std::move(fn);
+        for (int t = 0; t < n; t++) {
+            Uint32 begin = (Uint32)((Sint64)count * t / n);
+            Uint32 end = (Uint32)((Sint64)count * (t + 1) / n);
+            slices[t].bounds.store(Pack(begin, end),
+                                   std::memory_order_relaxed);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            participants = n;
+            active = n - 1;
+            generation++;
+        }
+        wake.notify_all();
+
+        RunSlice(0);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [&] { return active == 0; });
+        job = nullptr;
+    }
+};
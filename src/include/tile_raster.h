@@ -0,0 +1,116 @@
+#pragma once
+#include "soft_raster.h"
+#include "thread_pool.h"
+#include <vector>
+
+// Parallel front end for SoftRasterizer. Triangles come in as index triples
+// into a post-transform vertex array. The screen is split into binSize
+// tiles, triangles are binned by their bounding boxes, and each tile is then
+// cleared and rasterized by whichever pool thread picks it up. A tile only
+// ever writes its own pixels, so the framebuffer needs no locks. Binning is
+// split into one chunk per thread with its own bins, and tiles walk the chunks
+// in order so draw order (and depth ties) match the submission order.
+class TiledRasterizer
+{
+  public:
+    static constexpr int binSize = 64;
+
+  private:
+    SoftRasterizer& target;
+    int tilesX = 0, tilesY = 0;
+    std::vector<std::vector<std::vector<int>>> bins; // [chunk][tile]
+
+    void Prepare(int chunks)
+    {
+        int tx = (target.GetWidth() + binSize - 1) / binSize;
+        int ty = (target.GetHeight() + binSize - 1) / binSize;
+        if (tx != tilesX || ty != tilesY || (int)bins.size() != chunks) {
+            tilesX = tx;
+            tilesY = ty;
+            bins.assign(chunks, std::vector<std::vector<int>>(tx * ty));
+        }
+    }
+
+    void Bin(const std::vector<RasterVertex>& vertices,
+             const std::vector<Uint32>& indices,
+             int chunk,
+             int chunks)
+    {
+        auto& chunkBins = bins[chunk];
+        for (auto& bin : chunkBins)
+            bin.clear();
+
+        size_t count = indices.size() / 3;
+        size_t begin = count * chunk / chunks;
+        size_t end = count * (chunk + 1) / chunks;
+        for (size_t i = begin; i < end; i++) {
+            const RasterVertex& a = vertices[indices[i * 3]];
+            const RasterVertex& b = vertices[indices[i * 3 + 1]];
+            const RasterVertex& c = vertices[indices[i * 3 + 2]];
+            float minX = std::min({ a.x, b.x, c.x });
+            float maxX = std::max({ a.x, b.x, c.x });
+            float minY = std::min({ a.y, b.y, c.y });
+            float maxY = std::max({ a.y, b.y, c.y });
+
+            int x0 = std::max(0, (int)SDL_floorf(minX) / binSize);
+            int y0 = std::max(0, (int)SDL_floorf(minY) / binSize);
+            int x1 = std::min(tilesX - 1, (int)SDL_ceilf(maxX) / binSize);
+            int y1 = std::min(tilesY - 1, (int)SDL_ceilf(maxY) / binSize);
+            for (int ty = y0; ty <= y1; ty++)
+                for (int tx = x0; tx <= x1; tx++)
+                    chunkBins[ty * tilesX + tx].push_back((int)i);
+        }
+    }
+
+    void DrawTile(const std::vector<RasterVertex>& vertices,
+                  const std::vector<Uint32>& indices,
+                  int tile,
+                  Uint32 clearColor)
+    {
+        int tx = tile % tilesX, ty = tile / tilesX;
+        int x = tx * binSize, y = ty * binSize;
+        SDL_Rect rect = { x,
+                          y,
+                          std::min(binSize, target.GetWidth() - x),
+                          std::min(binSize, target.GetHeight() - y) };
+
+        target.Clear(clearColor, &rect);
+        for (const auto& chunkBins : bins) {
+            for (int i : chunkBins[tile])
+                target.DrawTriangle(vertices[indices[i * 3]],
+                                    vertices[indices[i * 3 + 1]],
+                                    vertices[indices[i * 3 + 2]],
+                                    &rect);
+        }
+    }
+
+  public:
+    explicit TiledRasterizer(SoftRasterizer& target)
+      : target(target)
+    {
+    }
+
+    // Clear the target and draw every triangle of `indices` using up to
+    // `threads` threads of the pool (all of them when <= 0)
+    void Render(ThreadPool& pool,
+                const std::vector<RasterVertex>& vertices,
+                const std::vector<Uint32>& indices,
+                Uint32 clearColor,
+                int threads = 0)
+    {
+        int chunks = threads <= 0 ? pool.GetMaxThreads()
+                                  : std::min(threads, pool.GetMaxThreads());
+        Prepare(chunks);
+
+        pool.ParallelFor(
+          chunks,
+          [&](int chunk, int) { Bin(vertices, indices, chunk, chunks); },
+          threads);
+        pool.ParallelFor(
+          tilesX * tilesY,
+          [&](int tile, int) {
+              DrawTile(vertices, indices, tile, clearColor);
+          },
+          threads);
+    }
+};
@@ -0,0 +1,319 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include "clip_stage.h"
+#include <glm/glm.hpp>
+#include <stddef.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define TRANSFORM_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+// Batch matrix product out[i] = a * b[i] over contiguous column-major
+// matrices, e.g. view-projection times every instance's model matrix. Each
+// output column is a linear combination of a's columns, summed left to right
+// like glm's scalar mat4 * mat4 (built without GLM_FORCE_INTRINSICS, whose
+// SSE path pairs the sums instead) and without FMA.
+// selectMatrixKernel() picks the widest one the CPU supports.
+typedef void (*MatrixBatchFn)(const glm::mat4& a,
+                              const glm::mat4* b,
+                              glm::mat4* out,
+                              size_t count);
+
+static inline void
+matrixBatchScalar(const glm::mat4& a,
+                  const glm::mat4* b,
+                  glm::mat4* out,
+                  size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        out[i] = a * b[i];
+}
+
+#ifdef TRANSFORM_KERNEL_X86
+
+// One matrix per iteration, one output column per register
+__attribute__((target("sse2"))) static inline void
+matrixBatchSSE2(const glm::mat4& a,
+                const glm::mat4* b,
+                glm::mat4* out,
+                size_t count)
+{
+    const __m128 a0 = _mm_loadu_ps(&a[0][0]);
+    const __m128 a1 = _mm_loadu_ps(&a[1][0]);
+    const __m128 a2 = _mm_loadu_ps(&a[2][0]);
+    const __m128 a3 = _mm_loadu_ps(&a[3][0]);
+
+    for (size_t i = 0; i < count; i++) {
+        for (int j = 0; j < 4; j++) {
+            __m128 col = _mm_loadu_ps(&b[i][j][0]);
+            __m128 r = _mm_mul_ps(a0, _mm_shuffle_ps(col, col, 0x00));
+            r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_shuffle_ps(col, col, 0x55)));
+            r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_shuffle_ps(col, col, 0xAA)));
+            r = _mm_add_ps(r, _mm_mul_ps(a3, _mm_shuffle_ps(col, col, 0xFF)));
+            _mm_storeu_ps(&out[i][j][0], r);
+        }
+    }
+}
+
+// One matrix per iteration, two output columns per register: a's columns are
+// duplicated into both 128-bit lanes and the in-lane shuffle broadcasts the
+// matching element of each of the two b columns
+__attribute__((target("avx"))) static inline void
+matrixBatchAVX(const glm::mat4& a,
+               const glm::mat4* b,
+               glm::mat4* out,
+               size_t count)
+{
+    const __m256 a0 = _mm256_broadcast_ps((const __m128*)&a[0][0]);
+    const __m256 a1 = _mm256_broadcast_ps((const __m128*)&a[1][0]);
+    const __m256 a2 = _mm256_broadcast_ps((const __m128*)&a[2][0]);
+    const __m256 a3 = _mm256_broadcast_ps((const __m128*)&a[3][0]);
+
+    for (size_t i = 0; i < count; i++) {
+        for (int j = 0; j < 4; j += 2) {
+            __m256 cols = _mm256_loadu_ps(&b[i][j][0]);
+            __m256 r = _mm256_mul_ps(a0, _mm256_shuffle_ps(cols, cols, 0x00));
+            r = _mm256_add_ps(
+              r, _mm256_mul_ps(a1, _mm256_shuffle_ps(cols, cols, 0x55)));
+            r = _mm256_add_ps(
+              r, _mm256_mul_ps(a2, _mm256_shuffle_ps(cols, cols, 0xAA)));
+            r = _mm256_add_ps(
+              r, _mm256_mul_ps(a3, _mm256_shuffle_ps(cols, cols, 0xFF)));
+            _mm256_storeu_ps(&out[i][j][0], r);
+        }
+    }
+}
+
+#endif
+
+// Batch vertex transform from SoA positions: clip = mvp * (x, y, z, 1) is
+// written to clip[i].position and, in the same pass, the perspective divide
+// and viewport mapping of ClipStage::Project to screen[i].x/y/z/invW. Colors
+// are left to the caller. Vertices behind the eye (w <= 0) get a meaningless
+// screen position, which the clip stage never reads since they are always
+// clipped away. The SIMD variants repeat the operation order of glm's
+// mat4 * vec4, which adds the four column products in pairs, and of Project,
+// with a true divide; cube --verify-transform reports how far they are from
+// the scalar path (0 when compiled without FMA contraction).
+typedef void (*VertexBatchFn)(const glm::mat4& mvp,
+                              const float* x,
+                              const float* y,
+                              const float* z,
+                              size_t count,
+                              float width,
+                              float height,
+                              ClipVertex* clip,
+                              RasterVertex* screen);
+
+static inline void
+vertexBatchScalar(const glm::mat4& mvp,
+                  const float* x,
+                  const float* y,
+                  const float* z,
+                  size_t count,
+                  float width,
+                  float height,
+                  ClipVertex* clip,
+                  RasterVertex* screen)
+{
+    for (size_t i = 0; i < count; i++) {
+        glm::vec4 p = mvp * glm::vec4(x[i], y[i], z[i], 1.0f);
+        float invW = 1.0f / p.w;
+        clip[i].position = p;
+        screen[i].x = (p.x * invW + 1.0f) * 0.5f * width;
+        screen[i].y = (1.0f - p.y * invW) * 0.5f * height;
+        screen[i].z = p.z * invW;
+        screen[i].invW = invW;
+    }
+}
+
+#ifdef TRANSFORM_KERNEL_X86
+
+// Transpose four SoA registers into four vertices and store each as the
+// first 16 bytes of its (unaligned, strided) destination
+#define TRANSFORM_STORE4(r0, r1, r2, r3, dst, field)                          \
+    do {                                                                       \
+        __m128 t0 = r0, t1 = r1, t2 = r2, t3 = r3;                             \
+        _MM_TRANSPOSE4_PS(t0, t1, t2, t3);                                     \
+        _mm_storeu_ps((float*)&(dst)[0].field, t0);                            \
+        _mm_storeu_ps((float*)&(dst)[1].field, t1);                            \
+        _mm_storeu_ps((float*)&(dst)[2].field, t2);                            \
+        _mm_storeu_ps((float*)&(dst)[3].field, t3);                            \
+    } while (0)
+
+// 4 vertices per iteration
+__attribute__((target("sse2"))) static inline void
+vertexBatchSSE2(const glm::mat4& mvp,
+                const float* x,
+                const float* y,
+                const float* z,
+                size_t count,
+                float width,
+                float height,
+                ClipVertex* clip,
+                RasterVertex* screen)
+{
+    __m128 m[4][4];
+    for (int c = 0; c < 4; c++)
+        for (int r = 0; r < 4; r++)
+            m[c][r] = _mm_set1_ps(mvp[c][r]);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 halfW = _mm_set1_ps(0.5f * width);
+    const __m128 halfH = _mm_set1_ps(0.5f * height);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 px = _mm_loadu_ps(x + i);
+        __m128 py = _mm_loadu_ps(y + i);
+        __m128 pz = _mm_loadu_ps(z + i);
+
+        // (m0 x + m1 y) + (m2 z + m3), paired like glm's mat4 * vec4
+        __m128 out[4];
+        for (int r = 0; r < 4; r++)
+            out[r] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m[0][r], px),
+                                           _mm_mul_ps(m[1][r], py)),
+                                _mm_add_ps(_mm_mul_ps(m[2][r], pz), m[3][r]));
+
+        __m128 invW = _mm_div_ps(one, out[3]);
+        __m128 sx =
+          _mm_mul_ps(_mm_add_ps(_mm_mul_ps(out[0], invW), one), halfW);
+        __m128 sy =
+          _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(out[1], invW)), halfH);
+        __m128 sz = _mm_mul_ps(out[2], invW);
+
+        TRANSFORM_STORE4(out[0], out[1], out[2], out[3], clip + i, position);
+        TRANSFORM_STORE4(sx, sy, sz, invW, screen + i, x);
+    }
+
+    vertexBatchScalar(mvp,
+                      x + i,
+                      y + i,
+                      z + i,
+                      count - i,
+                      width,
+                      height,
+                      clip + i,
+                      screen + i);
+}
+
+// 8 vertices per iteration; the stores go through two 4-wide transposes
+__attribute__((target("avx"))) static inline void
+vertexBatchAVX(const glm::mat4& mvp,
+               const float* x,
+               const float* y,
+               const float* z,
+               size_t count,
+               float width,
+               float height,
+               ClipVertex* clip,
+               RasterVertex* screen)
+{
+    __m256 m[4][4];
+    for (int c = 0; c < 4; c++)
+        for (int r = 0; r < 4; r++)
+            m[c][r] = _mm256_set1_ps(mvp[c][r]);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 halfW = _mm256_set1_ps(0.5f * width);
+    const __m256 halfH = _mm256_set1_ps(0.5f * height);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 px = _mm256_loadu_ps(x + i);
+        __m256 py = _mm256_loadu_ps(y + i);
+        __m256 pz = _mm256_loadu_ps(z + i);
+
+        __m256 out[4];
+        for (int r = 0; r < 4; r++)
+            out[r] = _mm256_add_ps(
+              _mm256_add_ps(_mm256_mul_ps(m[0][r], px),
+                            _mm256_mul_ps(m[1][r], py)),
+              _mm256_add_ps(_mm256_mul_ps(m[2][r], pz), m[3][r]));
+
+        __m256 invW = _mm256_div_ps(one, out[3]);
+        __m256 sx = _mm256_mul_ps(
+          _mm256_add_ps(_mm256_mul_ps(out[0], invW), one), halfW);
+        __m256 sy = _mm256_mul_ps(
+          _mm256_sub_ps(one, _mm256_mul_ps(out[1], invW)), halfH);
+        __m256 sz = _mm256_mul_ps(out[2], invW);
+
+        TRANSFORM_STORE4(_mm256_castps256_ps128(out[0]),
+                         _mm256_castps256_ps128(out[1]),
+                         _mm256_castps256_ps128(out[2]),
+                         _mm256_castps256_ps128(out[3]),
+                         clip + i,
+                         position);
+        TRANSFORM_STORE4(_mm256_extractf128_ps(out[0], 1),
+                         _mm256_extractf128_ps(out[1], 1),
+                         _mm256_extractf128_ps(out[2], 1),
+                         _mm256_extractf128_ps(out[3], 1),
+                         clip + i + 4,
+                         position);
+        TRANSFORM_STORE4(_mm256_castps256_ps128(sx),
+                         _mm256_castps256_ps128(sy),
+                         _mm256_castps256_ps128(sz),
+                         _mm256_castps256_ps128(invW),
+                         screen + i,
+                         x);
+        TRANSFORM_STORE4(_mm256_extractf128_ps(sx, 1),
+                         _mm256_extractf128_ps(sy, 1),
+                         _mm256_extractf128_ps(sz, 1),
+                         _mm256_extractf128_ps(invW, 1),
+                         screen + i + 4,
+                         x);
+    }
+
+    vertexBatchScalar(mvp,
+                      x + i,
+                      y + i,
+                      z + i,
+                      count - i,
+                      width,
+                      height,
+                      clip + i,
+                      screen + i);
+}
+
+#undef TRANSFORM_STORE4
+
+#endif
+
+static inline MatrixBatchFn
+selectMatrixKernel(const char** name = nullptr)
+{
+#ifdef TRANSFORM_KERNEL_X86
+    if (SDL_HasAVX()) {
+        if (name)
+            *name = "avx";
+        return matrixBatchAVX;
+    }
+    if (SDL_HasSSE2()) {
+        if (name)
+            *name = "sse2";
+        return matrixBatchSSE2;
+    }
+#endif
+    if (name)
+        *name = "scalar";
+    return matrixBatchScalar;
+}
+
+static inline VertexBatchFn
+selectVertexKernel(const char** name = nullptr)
+{
+#ifdef TRANSFORM_KERNEL_X86
+    if (SDL_HasAVX()) {
+        if (name)
+            *name = "avx";
+        return vertexBatchAVX;
+    }
+    if (SDL_HasSSE2()) {
+        if (name)
+            *name = "sse2";
+        return vertexBatchSSE2;
+    }
+#endif
+    if (name)
+        *name = "scalar";
+    return vertexBatchScalar;
+}
@@ -1,17 +1,89 @@
 #define SDL_MAIN_USE_CALLBACKS
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_main.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include "asset_loader.h"
+#include "frame_scheduler.h"
+#include "input_pump.h"
+#include "progress_bar.h"
+#include "retained_layer.h"
+#include "tiny_ttf.h"
+#include <string>
+#include <vector>
 
 SDL_Window* window;
 SDL_Renderer* renderer;
 SDL_FRect health_bar;
+FrameScheduler scheduler("loading", 60.0, 60.0);
+InputPump input("loading");
+
+// Ảnh và font được đọc/giải mã trên luồng nền; mỗi frame chỉ upload texture
+// trong upload_budget nên thanh tiến độ vẫn mượt khi tập asset lớn
+AssetLoader* loader;
+std::vector<int> images;
+Uint64 upload_budget = 4 * SDL_NS_PER_MS;
+bool reported = false;
+
+// Nền (màu nền, viền thanh) vẽ một lần; mỗi frame chỉ vẽ lại phần thanh,
+// dòng chữ và ô thumbnail vừa đổi, xong hết thì không present nữa
+RetainedLayer* layer;
+SDL_FRect decoded_rect, done_rect; // as last drawn
+char status[128];
+std::vector<SDL_Texture*> thumbs;
 
 #define WIDTH 960
 #define HEIGHT 540
+#define THUMB 48
+#define COLUMNS (WIDTH / (THUMB + 8))
+
+static void
+AddAsset(const char* path)
+{
+    const char* ext = SDL_strrchr(path, '.');
+    if (ext && (SDL_strcasecmp(ext, ".ttf") == 0 ||
+                SDL_strcasecmp(ext, ".otf") == 0)) {
+        loader->addFont(path, 24.0f);
+    } else {
+        images.push_back(loader->addImage(path));
+    }
+}
+
+// The atlas pages the build puts next to the executable (src/images is
+// packed into them, see CMakeLists.txt)
+static void
+AddDefaultAssets(std::vector<std::string>& paths)
+{
+    char* dir = NULL;
+    SDL_asprintf(&dir, "%simages", SDL_GetBasePath());
+    int count = 0;
+    char** files = SDL_GlobDirectory(dir, "atlas*.bmp", 0, &count);
+    for (int i = 0; files && i < count; i++)
+        paths.push_back(std::string(dir) + "/" + files[i]);
+    SDL_free(files);
+    SDL_free(dir);
+}
 
 SDL_AppResult
 SDL_AppInit(void** appstate, int argc, char** argv)
 {
+    // loading [--threads N] [--budget MS] [--repeat N] [ASSET...]
+    // Không có ASSET: các trang atlas và font nhúng (font của demo font),
+    // lặp lại default_repeat lần để thanh tiến độ có việc mà chạy
+    const int default_repeat = 16;
+    int threads = 0, repeat = 0;
+    std::vector<std::string> paths;
+    for (int i = 1; i < argc; i++) {
+        if (SDL_strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = SDL_atoi(argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--budget") == 0 && i + 1 < argc) {
+            upload_budget = (Uint64)(SDL_atof(argv[++i]) * SDL_NS_PER_MS);
+        } else if (SDL_strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = SDL_atoi(argv[++i]);
+        } else {
+            paths.push_back(argv[i]);
+        }
+    }
+
     // create a window
     if (!SDL_CreateWindowAndRenderer("Hello, Triangle!",
                                      WIDTH,
@@ -22,29 +94,152 @@ SDL_AppInit(void** appstate, int argc, char** argv)
         SDL_Log("error: %s", SDL_GetError());
         return SDL_APP_FAILURE;
     }
+    scheduler.setVSync(renderer);
+    layer = new RetainedLayer(renderer);
+
+    if (!TTF_Init()) {
+        SDL_Log("error: %s", SDL_GetError());
+        return SDL_APP_FAILURE;
+    }
+
+    bool defaults = paths.empty();
+    if (defaults)
+        AddDefaultAssets(paths);
+    repeat = SDL_max(1, repeat > 0 ? repeat : defaults ? default_repeat : 1);
+    loader = new AssetLoader(threads);
+    for (int r = 0; r < repeat; r++) {
+        for (const std::string& path : paths)
+            AddAsset(path.c_str());
+        if (defaults)
+            loader->addFont("tiny.ttf (embedded)", tiny_ttf, tiny_ttf_len, 24);
+    }
+    SDL_Log("loading %d assets (%.1f MB)",
+            loader->getAssetCount(),
+            loader->getBytesTotal() / 1e6);
 
     return SDL_APP_CONTINUE;
 }
 
-SDL_AppResult
-SDL_AppIterate(void* appstate)
+static SDL_FRect
+BarRect()
+{
+    SDL_FRect bar;
+    bar.w = WIDTH / 3.0;
+    bar.h = HEIGHT / 20.0;
+    bar.x = (WIDTH - bar.w) / 2.0;
+    bar.y = (HEIGHT - bar.h) / 2.0;
+    return bar;
+}
+
+static SDL_FRect
+ThumbRect(int i)
+{
+    return { 8.0f + i * (THUMB + 8), HEIGHT - THUMB - 16.0f, THUMB, THUMB };
+}
+
+static void
+SetDrawColor(const SDL_FColor& c)
+{
+    SDL_SetRenderDrawColorFloat(renderer, c.r, c.g, c.b, c.a);
+}
+
+static void
+DrawBackground()
 {
     SDL_SetRenderDrawColor(renderer, 30, 30, 30, 255);
     SDL_RenderClear(renderer);
 
-    health_bar.w = WIDTH / 3.0;
-    health_bar.h = HEIGHT / 20.0;
-    health_bar.x = (WIDTH - health_bar.w) / 2.0;
-    health_bar.y = (HEIGHT - health_bar.h) / 2.0;
-
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+    health_bar = BarRect();
+    SetDrawColor(ProgressBarParts::outline);
     SDL_RenderRect(renderer, &health_bar);
+}
+
+static void
+DrawForeground()
+{
+    // Phần đã giải mã (xám) chạy trước phần đã xong hẳn (trắng)
+    SetDrawColor(ProgressBarParts::ahead);
+    SDL_RenderFillRect(renderer, &decoded_rect);
+    SetDrawColor(ProgressBarParts::done);
+    SDL_RenderFillRect(renderer, &done_rect);
+
+    health_bar = BarRect();
+    SDL_RenderDebugText(
+      renderer, health_bar.x, health_bar.y + health_bar.h + 8, status);
+
+    // Texture đã upload, xếp thành hàng dưới thanh
+    for (int i = 0; i < (int)thumbs.size(); i++) {
+        SDL_FRect thumb = ThumbRect(i);
+        SDL_RenderTexture(renderer, thumbs[i], NULL, &thumb);
+    }
+}
 
-    long scale = SDL_GetTicks() / 100 % 101;
-    health_bar.w = health_bar.w / 100 * scale;
-    SDL_RenderFillRect(renderer, &health_bar);
+SDL_AppResult
+SDL_AppIterate(void* appstate)
+{
+    scheduler.beginFrame();
+    for (const SDL_Event& event : input.drain())
+        layer->handleEvent(&event);
+
+    loader->update(renderer, upload_budget);
+
+    // Invalidate only what changed since the last frame
+    health_bar = BarRect();
+    layer->move(decoded_rect,
+                ProgressBarParts::fill(health_bar,
+                                       loader->getDecodeProgress()));
+    layer->move(done_rect,
+                ProgressBarParts::fill(health_bar, loader->getProgress()));
+
+    char text[sizeof(status)];
+    SDL_snprintf(text,
+                 sizeof(text),
+                 "%d/%d assets  %.1f/%.1f MB",
+                 loader->getDoneCount(),
+                 loader->getAssetCount(),
+                 loader->getBytesDone() / 1e6,
+                 loader->getBytesTotal() / 1e6);
+    if (SDL_strcmp(text, status) != 0) {
+        size_t length = SDL_max(SDL_strlen(text), SDL_strlen(status));
+        layer->invalidate({ health_bar.x,
+                            health_bar.y + health_bar.h + 8,
+                            8.0f * length,
+                            8.0f });
+        SDL_strlcpy(status, text, sizeof(status));
+    }
+
+    std::vector<SDL_Texture*> shown;
+    for (int i = 0; i < (int)images.size() && shown.size() < COLUMNS; i++)
+        if (SDL_Texture* texture = loader->getTexture(images[i]))
+            shown.push_back(texture);
+    for (int i = 0; i < (int)SDL_max(shown.size(), thumbs.size()); i++)
+        if (i >= (int)shown.size() || i >= (int)thumbs.size() ||
+            shown[i] != thumbs[i])
+            layer->invalidate(ThumbRect(i));
+    thumbs.swap(shown);
+
+    if (layer->draw(DrawBackground, DrawForeground)) {
+        input.presented();
+        scheduler.endFrame();
+    } else {
+        input.skipped();
+        // Xong hết và không có gì đổi: ngủ tới event kế tiếp
+        if (loader->isDone())
+            layer->waitWhileIdle(1000);
+        scheduler.skipFrame();
+    }
 
-    SDL_RenderPresent(renderer);
+    if (!reported && loader->isDone()) {
+        SDL_Log("loaded %d assets (%d failed, %.1f MB read, %.1f MB of "
+                "textures) in %.1f ms, longest upload slice %.2f ms",
+                loader->getAssetCount(),
+                loader->getFailedCount(),
+                loader->getBytesDone() / 1e6,
+                loader->getTextureBytes() / 1e6,
+                loader->getElapsed() / 1e6,
+                loader->getMaxUpdateTime() / 1e6);
+        reported = true;
+    }
 
     return SDL_APP_CONTINUE;
 }
@@ -57,11 +252,23 @@ SDL_AppEvent(void* appstate, SDL_Event* event)
         return SDL_APP_SUCCESS;
     }
 
+    // the rest is handled at the start of the next frame
+    input.push(event);
     return SDL_APP_CONTINUE;
 }
 
 void
 SDL_AppQuit(void* appstate, SDL_AppResult result)
 {
+    if (layer) {
+        SDL_Log("retained: presented %llu frames, skipped %llu, %.1f%% of "
+                "presented pixels recomposed",
+                (unsigned long long)layer->getFramesPresented(),
+                (unsigned long long)layer->getFramesSkipped(),
+                layer->getComposedRatio() * 100.0f);
+        delete layer;
+    }
+    delete loader; // closes the fonts, so before TTF_Quit
+    TTF_Quit();
     SDL_DestroyWindow(window);
 }
\ No newline at end of file
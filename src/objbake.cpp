@@ -0,0 +1,154 @@
+#include <SDL3/SDL.h>
+#include "mesh.h"
+#include <charconv>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Bake Wavefront OBJ files into the binary mesh format that cube maps
+// straight into memory, and measure how long each path takes to load.
+//
+//   objbake input.obj output.mesh
+//   objbake --sphere STACKS SLICES output.obj   (2 * STACKS * SLICES tris)
+//   objbake --bench input.obj
+
+static double
+Milliseconds(Uint64 start)
+{
+    return (SDL_GetPerformanceCounter() - start) * 1000.0 /
+           SDL_GetPerformanceFrequency();
+}
+
+static void
+AppendNumber(std::string& out, float value)
+{
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+static bool
+WriteSphereOBJ(int stacks, int slices, const char* path)
+{
+    std::vector<Vertex> vertices;
+    std::vector<Uint32> indices;
+    MakeSphere(stacks, slices, vertices, indices);
+
+    // Format the whole file in memory and write it once
+    std::string text;
+    text.reserve(vertices.size() * 64 + indices.size() * 8);
+    for (const Vertex& v : vertices) {
+        text += "v";
+        for (int k = 0; k < 3; k++) {
+            text += ' ';
+            AppendNumber(text, v.position[k]);
+        }
+        for (int k = 0; k < 3; k++) {
+            text += ' ';
+            AppendNumber(text, v.color[k]);
+        }
+        text += '\n';
+    }
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        text += "f " + std::to_string(indices[i] + 1) + ' ' +
+                std::to_string(indices[i + 1] + 1) + ' ' +
+                std::to_string(indices[i + 2] + 1) + '\n';
+    }
+
+    if (!SDL_SaveFile(path, text.data(), text.size())) {
+        std::cerr << "Couldn't write " << path << ": " << SDL_GetError()
+                  << std::endl;
+        return false;
+    }
+    std::cout << path << ": " << indices.size() / 3 << " triangles, "
+              << text.size() / (1024 * 1024) << " MiB" << std::endl;
+    return true;
+}
+
+static bool
+Bake(const char* input, const char* output)
+{
+    Mesh mesh;
+    Uint64 start = SDL_GetPerformanceCounter();
+    if (!mesh.LoadOBJ(input))
+        return false;
+    double parse = Milliseconds(start);
+
+    start = SDL_GetPerformanceCounter();
+    if (!mesh.SaveBinary(output))
+        return false;
+    std::cout << input << ": " << mesh.VertexCount() << " vertices, "
+              << mesh.TriangleCount() << " triangles; parse " << parse
+              << " ms, write " << Milliseconds(start) << " ms" << std::endl;
+    return true;
+}
+
+// Touch every vertex and index so lazily mapped pages are actually read
+static Uint64
+Checksum(const Mesh& mesh)
+{
+    Uint64 sum = 0;
+    for (size_t i = 0; i < mesh.IndexCount(); i++)
+        sum += mesh.Indices()[i];
+    for (size_t i = 0; i < mesh.VertexCount(); i++)
+        sum += (Uint64)(mesh.Vertices()[i].position.x * 1024.0f);
+    return sum;
+}
+
+static bool
+Bench(const char* input)
+{
+    std::string baked = std::string(input) + ".mesh";
+    if (!Bake(input, baked.c_str()))
+        return false;
+
+    Mesh obj;
+    Uint64 start = SDL_GetPerformanceCounter();
+    obj.LoadOBJ(input);
+    double parse = Milliseconds(start);
+
+    // Đọc cả file vào bộ nhớ, để so với map không copy
+    start = SDL_GetPerformanceCounter();
+    size_t size = 0;
+    void* copy = SDL_LoadFile(baked.c_str(), &size);
+    double read = Milliseconds(start);
+    SDL_free(copy);
+
+    Mesh mapped;
+    start = SDL_GetPerformanceCounter();
+    if (!mapped.LoadBinary(baked.c_str()))
+        return false;
+    double map = Milliseconds(start);
+    start = SDL_GetPerformanceCounter();
+    Uint64 sum = Checksum(mapped);
+    double touch = Milliseconds(start);
+
+    std::cout << mapped.TriangleCount() << " triangles, "
+              << size / (1024 * 1024) << " MiB baked" << std::endl;
+    std::cout << "obj parse:      " << parse << " ms" << std::endl;
+    std::cout << "binary read:    " << read << " ms" << std::endl;
+    std::cout << "binary map:     " << map << " ms" << std::endl;
+    std::cout << "map + touch:    " << map + touch << " ms (checksum " << sum
+              << ")" << std::endl;
+    SDL_RemovePath(baked.c_str());
+    return true;
+}
+
+int
+main(int argc, char* argv[])
+{
+    if (argc == 5 && SDL_strcmp(argv[1], "--sphere") == 0)
+        return WriteSphereOBJ(SDL_atoi(argv[2]), SDL_atoi(argv[3]), argv[4])
+                 ? 0
+                 : 1;
+    if (argc == 3 && SDL_strcmp(argv[1], "--bench") == 0)
+        return Bench(argv[2]) ? 0 : 1;
+    if (argc == 3)
+        return Bake(argv[1], argv[2]) ? 0 : 1;
+
+    std::cerr << "usage: objbake input.obj output.mesh\n"
+                 "       objbake --sphere STACKS SLICES output.obj\n"
+                 "       objbake --bench input.obj"
+              << std::endl;
+    return 2;
+}
@@ -0,0 +1,276 @@
+#define SDL_MAIN_USE_CALLBACKS 1
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include "glyph_cache.h"
+#include "input_pump.h"
+#include "oop.h"
+#include "sprite_batch.h"
+#include "text_layout.h"
+#include "tiny_ttf.h"
+
+// Widget toolkit demo: a grid of --widgets N buttons (2000 by default), a
+// list, a virtual list of --rows N items (200000 by default), a progress bar
+// and labels, drawn in one batch every frame. Clicking a button counts on
+// it; S logs a hit-test comparison between the grid and a linear scan.
+
+#define WIDTH 1360
+#define HEIGHT 768
+
+static SDL_Window* window = NULL;
+static SDL_Renderer* renderer = NULL;
+static TTF_Font* font = NULL;
+
+static GlyphCache* glyphs = NULL;
+static TextLayout* layout = NULL;
+static SpriteBatch* batch = NULL;
+static UiPainter* painter = NULL;
+static Ui* ui = NULL;
+// Motion đã được gộp: mỗi frame chỉ một lần hit-test cho hover
+static InputPump* input = NULL;
+
+static Label* status = NULL;
+static ProgressBar* progress = NULL;
+static VirtualList* rows = NULL;
+static int clicks = 0;
+
+// Thống kê mỗi giây
+static Uint64 stats_start = 0;
+static int stats_frames = 0;
+static Uint64 stats_quads = 0, stats_draw_calls = 0, stats_build_ns = 0;
+static Uint64 stats_rows_built = 0;
+
+static void
+CompareHitTests(void)
+{
+    const int tests = 100000;
+    Uint64 found_grid = 0, found_linear = 0;
+
+    SDL_srand(1);
+    ui->resetStats();
+    Uint64 start = SDL_GetTicksNS();
+    for (int i = 0; i < tests; i++)
+        found_grid +=
+          ui->hitTest(SDL_randf() * WIDTH, SDL_randf() * HEIGHT) != NULL;
+    Uint64 grid_ns = SDL_GetTicksNS() - start;
+    float grid_candidates = ui->getCandidatesPerTest();
+
+    SDL_srand(1);
+    ui->resetStats();
+    start = SDL_GetTicksNS();
+    for (int i = 0; i < tests; i++)
+        found_linear +=
+          ui->hitTestLinear(SDL_randf() * WIDTH, SDL_randf() * HEIGHT) != NULL;
+    Uint64 linear_ns = SDL_GetTicksNS() - start;
+
+    SDL_Log("hit tests over %d widgets: grid %.1f ns and %.1f checks each, "
+            "linear scan %.1f ns and %.1f checks each (%s)",
+            ui->getWidgetCount(),
+            grid_ns / (double)tests,
+            grid_candidates,
+            linear_ns / (double)tests,
+            ui->getCandidatesPerTest(),
+            found_grid == found_linear ? "same hits" : "HITS DIFFER");
+    ui->resetStats();
+}
+
+SDL_AppResult
+SDL_AppInit(void** appstate, int argc, char* argv[])
+{
+    // ui [--widgets N] [--rows N] [--font PATH]
+    int count = 2000;
+    int row_count = 200000;
+    const char* font_path = NULL; // the embedded font
+    for (int i = 1; i < argc; i++) {
+        if (SDL_strcmp(argv[i], "--widgets") == 0 && i + 1 < argc) {
+            count = SDL_atoi(argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--rows") == 0 && i + 1 < argc) {
+            row_count = SDL_atoi(argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--font") == 0 && i + 1 < argc) {
+            font_path = argv[++i];
+        }
+    }
+    count = SDL_max(1, count);
+
+    if (!SDL_CreateWindowAndRenderer(
+          "Widgets", WIDTH, HEIGHT, 0, &window, &renderer)) {
+        SDL_Log("error: %s", SDL_GetError());
+        return SDL_APP_FAILURE;
+    }
+    SDL_SetRenderVSync(renderer, 1);
+    if (!TTF_Init()) {
+        SDL_Log("error: %s", SDL_GetError());
+        return SDL_APP_FAILURE;
+    }
+
+    // Nút nhỏ dần khi nhiều nút; cỡ chữ theo cỡ nút
+    const SDL_FRect grid_area = { 16, 72, WIDTH - 16 * 3 - 280, HEIGHT - 88 };
+    float cell = SDL_floorf(SDL_sqrtf(grid_area.w * grid_area.h / count));
+    int columns = SDL_max(1, (int)(grid_area.w / cell));
+
+    const float font_size = SDL_clamp(cell * 0.4f, 7.0f, 16.0f);
+    if (font_path) {
+        font = TTF_OpenFont(font_path, font_size);
+        if (!font)
+            SDL_Log("%s: %s, using the embedded font",
+                    font_path,
+                    SDL_GetError());
+    }
+    if (!font)
+        font = openTinyFont(font_size);
+    if (!font)
+        SDL_Log("Couldn't open font: %s, drawing without text", SDL_GetError());
+
+    glyphs = new GlyphCache(renderer);
+    layout = new TextLayout(*glyphs);
+    batch = new SpriteBatch(renderer);
+    painter = new UiPainter(*batch, *glyphs, *layout, font);
+    ui = new Ui();
+    input = new InputPump("ui");
+
+    ui->add<Label>(SDL_FRect{ 16, 8, 400, 24 }, "Widgets");
+    status = &ui->add<Label>(SDL_FRect{ 16, 36, 400, 24 }, "no clicks yet");
+    progress = &ui->add<ProgressBar>(SDL_FRect{ 440, 20, 400, 24 });
+
+    for (int i = 0; i < count; i++) {
+        char text[16];
+        SDL_snprintf(text, sizeof(text), "%d", i);
+        SDL_FRect rect = { grid_area.x + (i % columns) * cell,
+                           grid_area.y + (i / columns) * cell,
+                           cell - 2,
+                           cell - 2 };
+        ui->add<Button>(rect, text, [](Button& button) {
+            clicks++;
+            char line[64];
+            SDL_snprintf(line,
+                         sizeof(line),
+                         "clicked %s (%d clicks)",
+                         button.getText().c_str(),
+                         clicks);
+            status->setText(line);
+        });
+    }
+
+    // Cột phải: danh sách thường ở trên, danh sách ảo ở dưới
+    float row = font ? TTF_GetFontLineSkip(font) + 4.0f : 16.0f;
+    float half = (HEIGHT - 88 - 16) / 2.0f;
+    List& list =
+      ui->add<List>(SDL_FRect{ WIDTH - 16 - 280, 72, 280, half }, row);
+    for (int i = 0; i < 500; i++) {
+        char text[32];
+        SDL_snprintf(text, sizeof(text), "item %d", i);
+        list.add(text);
+    }
+    list.setOnSelect([](List& l, int i) {
+        status->setText(("selected " + l.getItem(i)).c_str());
+    });
+
+    rows = &ui->add<VirtualList>(
+      SDL_FRect{ WIDTH - 16 - 280, 72 + half + 16, 280, half },
+      row,
+      row_count,
+      [](int index, std::string& out) {
+          char text[64];
+          SDL_snprintf(text,
+                       sizeof(text),
+                       "row %d  0x%08x",
+                       index,
+                       (unsigned)index * 2654435761u);
+          out = text;
+      });
+    rows->setOnSelect([](VirtualList& l, int i) {
+        char line[64];
+        SDL_snprintf(line, sizeof(line), "selected row %d", i);
+        status->setText(line);
+    });
+
+    SDL_Log("%d widgets, %d buttons of %.0f px, %d virtual rows",
+            ui->getWidgetCount(),
+            count,
+            cell,
+            rows->getCount());
+    CompareHitTests();
+    stats_start = SDL_GetTicksNS();
+
+    return SDL_APP_CONTINUE;
+}
+
+SDL_AppResult
+SDL_AppEvent(void* appstate, SDL_Event* event)
+{
+    if (event->type == SDL_EVENT_QUIT) {
+        return SDL_APP_SUCCESS;
+    }
+    input->push(event);
+    return SDL_APP_CONTINUE;
+}
+
+SDL_AppResult
+SDL_AppIterate(void* appstate)
+{
+    for (const SDL_Event& event : input->drain()) {
+        if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_S) {
+            CompareHitTests();
+        }
+        ui->handleEvent(&event);
+    }
+
+    Uint64 now = SDL_GetTicksNS();
+    progress->setValue(SDL_fmodf(now / 4e9f, 1.0f),
+                       SDL_fmodf(now / 4e9f + 0.1f, 1.0f));
+
+    SDL_SetRenderDrawColor(renderer, 30, 30, 30, 255);
+    SDL_RenderClear(renderer);
+
+    Uint64 start = SDL_GetTicksNS();
+    Uint64 rows_built = rows->getRowsBuilt();
+    ui->draw(*painter);
+    stats_rows_built += rows->getRowsBuilt() - rows_built;
+    batch->flush();
+    stats_build_ns += SDL_GetTicksNS() - start;
+    stats_quads += batch->getSpriteCount();
+    stats_draw_calls += batch->getDrawCalls();
+    batch->resetStats();
+
+    SDL_RenderPresent(renderer);
+    input->presented();
+
+    stats_frames++;
+    if (now - stats_start >= SDL_NS_PER_SECOND) {
+        SDL_Log("%d widgets: %.0f quads and %.1f draw calls per frame, "
+                "%.2f ms/frame building, %.1f fps; %llu hit tests, %.1f "
+                "checks each; %llu of %d rows built in a pool of %d",
+                ui->getWidgetCount(),
+                (double)stats_quads / stats_frames,
+                (double)stats_draw_calls / stats_frames,
+                stats_build_ns / 1e6 / stats_frames,
+                stats_frames * 1e9 / (now - stats_start),
+                (unsigned long long)ui->getHitTests(),
+                ui->getCandidatesPerTest(),
+                (unsigned long long)stats_rows_built,
+                rows->getCount(),
+                rows->getPoolSize());
+        ui->resetStats();
+        stats_start = now;
+        stats_frames = 0;
+        stats_quads = stats_draw_calls = stats_build_ns = 0;
+        stats_rows_built = 0;
+    }
+
+    return SDL_APP_CONTINUE;
+}
+
+void
+SDL_AppQuit(void* appstate, SDL_AppResult result)
+{
+    delete input;
+    delete ui;
+    delete painter;
+    delete batch;
+    delete layout;
+    delete glyphs;
+    if (font) {
+        TTF_CloseFont(font);
+    }
+    TTF_Quit();
+}